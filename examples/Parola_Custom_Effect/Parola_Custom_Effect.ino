@@ -0,0 +1,89 @@
+// Demonstrates a user defined text effect using PA_CUSTOM.
+//
+// The effect function is called by the library for every animation frame
+// and builds the frame from the message columns. In this example the
+// message columns drop into place from the top of the display one after
+// the other, and drop out of the bottom of the display on exit.
+//
+// MD_MAX72XX library can be found at https://github.com/MajicDesigns/MD_MAX72XX
+//
+
+#include <MD_Parola.h>
+#include <MD_MAX72xx.h>
+#include <SPI.h>
+
+// Define the number of devices we have in the chain and the hardware interface
+// NOTE: These pin numbers may not work with your hardware and may need changing
+#define HARDWARE_TYPE MD_MAX72XX::PAROLA_HW
+#define MAX_DEVICES 4
+
+#define CLK_PIN   13
+#define DATA_PIN  11
+#define CS_PIN    10
+
+// HARDWARE SPI
+MD_Parola P = MD_Parola(HARDWARE_TYPE, CS_PIN, MAX_DEVICES);
+// SOFTWARE SPI
+//MD_Parola P = MD_Parola(HARDWARE_TYPE, DATA_PIN, CLK_PIN, CS_PIN, MAX_DEVICES);
+
+#define PAUSE_TIME  2000
+#define SPEED_TIME  25
+
+const char *msg[] =
+{
+  "Drop",
+  "Custom",
+  "Effect",
+};
+
+bool effectDrop(effectFrame_t *f)
+// Each message column starts moving 2 frames after the one to its left
+// and moves down one LED every frame.
+{
+  colData_t blank = (f->inverted ? ~0 : 0);
+  bool bDone = true;
+
+  for (uint16_t i = 0; i < f->frameSize; i++)
+    f->frame[i] = blank;
+
+  for (uint16_t i = 0; i < f->textSize; i++)
+  {
+    int16_t c = f->textPos - i;       // frame column for this message column
+    int16_t step = f->frameNum - (i / 2);  // LEDs moved by this column
+    colData_t col = f->text[i];
+
+    if (step < f->height)
+      bDone = false;
+
+    if (c < 0 || c >= f->frameSize)
+      continue;
+
+    if (f->bIn)   // drop in from the top
+      col = (step <= 0 ? 0 : (step < f->height ? col >> (f->height - step) : col));
+    else          // drop out of the bottom
+      col = (step <= 0 ? col : (step < f->height ? col << step : 0));
+
+    f->frame[c] = (f->inverted ? ~col : col);
+  }
+
+  return(bDone);
+}
+
+void setup(void)
+{
+  P.begin();
+  P.setCustomEffect(effectDrop);
+}
+
+void loop(void)
+{
+  static uint8_t cycle = 0;
+
+  if (P.displayAnimate())
+  {
+    P.displayText(msg[cycle], PA_CENTER, SPEED_TIME, PAUSE_TIME, PA_CUSTOM, PA_CUSTOM);
+
+    // prepare for next pass
+    cycle = (cycle + 1) % ARRAY_SIZE(msg);
+  }
+}
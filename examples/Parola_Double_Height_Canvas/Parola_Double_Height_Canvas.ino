@@ -0,0 +1,109 @@
+// Demonstrates one double height display using a single canvas zone and a
+// single font file definition created with the MD_MAX72xx font builder.
+//
+// Each font file has the lower part of a character as ASCII codes 0-127 and the
+// upper part of the character in ASCII code 128-255. The PA_DOUBLE_HEIGHT zone
+// effect puts both halves of each character together, so the same message is
+// used for the whole display and both halves are animated by the same zone.
+//
+// The display is 2 rows of modules set up as a canvas with the module numbers
+// in the sequence shown below:
+//
+// * Modules (like FC-16) that can fit over each other with no gap
+//  n n-1 n-2 ... n/2+1   <- this direction top row
+//  n/2 ... 3  2  1  0    <- this direction bottom row
+//
+// * Modules (like Generic and Parola) that cannot fit over each other with no gap
+//  n/2+1 ... n-2 n-1 n   -> this direction top row
+//  n/2 ... 3  2  1  0    <- this direction bottom row
+//
+// NOTE: ENA_CANVAS must be set to 1 in MD_Parola.h for this example to compile.
+//
+// MD_MAX72XX library can be found at https://github.com/MajicDesigns/MD_MAX72XX
+//
+
+#include <MD_Parola.h>
+#include <MD_MAX72xx.h>
+#include <SPI.h>
+#include "Font_Data.h"
+
+#if !ENA_CANVAS
+#error "This example needs ENA_CANVAS set to 1 in MD_Parola.h"
+#endif
+
+// Turn debugging on and off
+#define DEBUG 0
+
+#if DEBUG
+#define PRINTS(s)   { Serial.print(F(s)); }
+#define PRINT(s, v) { Serial.print(F(s)); Serial.print(v); }
+#else
+#define PRINTS(s)
+#define PRINT(s, v)
+#endif
+
+// Define the number of devices we have in the chain and the hardware interface
+// NOTE: These pin numbers may not work with your hardware and may need changing
+#define HARDWARE_TYPE MD_MAX72XX::PAROLA_HW
+#define NUM_ROWS 2
+#define MODULES_PER_ROW 4
+#define MAX_DEVICES (NUM_ROWS * MODULES_PER_ROW)
+
+#define PAUSE_TIME 1000
+#define SCROLL_SPEED 50
+
+#define CLK_PIN   13
+#define DATA_PIN  11
+#define CS_PIN    10
+
+// HARDWARE SPI
+MD_Parola P = MD_Parola(HARDWARE_TYPE, CS_PIN, MAX_DEVICES);
+// SOFTWARE SPI
+//MD_Parola P = MD_Parola(HARDWARE_TYPE, DATA_PIN, CLK_PIN, CS_PIN, MAX_DEVICES);
+
+const char *msg[] =
+{
+  "Double height with custom font & 1 zone",
+  "ABCDEFGHIJKLMNOPQRSTUVWXYZ",
+  "abcdefghijklmnopqrstuvwxyz",
+  "0123456789",
+  "`!@#$%^&*()_+-={};:'<>\"?,./|\\{}",
+};
+
+void setup(void)
+{
+  // Modules that cannot fit over each other are mounted with the top row upside down
+  bool flipUpperRow = (HARDWARE_TYPE == MD_MAX72XX::GENERIC_HW || HARDWARE_TYPE == MD_MAX72XX::PAROLA_HW);
+
+#if DEBUG
+  Serial.begin(57600);
+  PRINTS("\n[Double_Height_Canvas]");
+#endif
+
+  // initialise the LED display
+  P.begin();
+
+  // One zone covering both rows of the display
+  P.setCanvas(NUM_ROWS, flipUpperRow);
+  P.setZoneRect(0, 0, (MODULES_PER_ROW * COL_SIZE) - 1, 0, NUM_ROWS - 1);
+  P.setZoneEffect(0, true, PA_DOUBLE_HEIGHT);
+  P.setFont(BigFont);
+  P.setCharSpacing(P.getCharSpacing() * 2); // double height --> double spacing
+  PRINT("\nFLIP=", flipUpperRow);
+}
+
+void loop(void)
+{
+  static uint8_t cycle = 0;
+
+  if (P.displayAnimate())
+  {
+    PRINT("\n", cycle);
+    PRINT(": ", msg[cycle]);
+
+    P.displayText(msg[cycle], PA_CENTER, SCROLL_SPEED, PAUSE_TIME, PA_SCROLL_LEFT, PA_SCROLL_UP);
+
+    // prepare for next pass
+    cycle = (cycle + 1) % ARRAY_SIZE(msg);
+  }
+}
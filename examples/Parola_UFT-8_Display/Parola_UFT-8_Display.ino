@@ -1,7 +1,9 @@
 // Program to demonstrate the MD_Parola library
 //
-// Demonstrates how UTF-8 multi-byte characters can be mapped to Extended ASCII
-// characters that can be displayed with a suitable font file.
+// Demonstrates how UTF-8 multi-byte characters are displayed using the library
+// UTF-8 decoding. Characters are looked up by their Unicode code point, so
+// Latin-1 characters are found in a suitable extended ASCII font file and other
+// characters can be mapped to user defined characters.
 //
 // MD_MAX72XX library can be found at https://github.com/MajicDesigns/MD_MAX72XX
 //
@@ -53,73 +55,32 @@ char	pc[][20] =
 //  "20µs/°C",
 };
 
-uint8_t utf8Ascii(uint8_t ascii)
-// Convert a single Character from UTF8 to Extended ASCII according to ISO 8859-1,
-// also called ISO Latin-1. Codes 128-159 contain the Microsoft Windows Latin-1
-// extended characters:
-// - codes 0..127 are identical in ASCII and UTF-8
-// - codes 160..191 in ISO-8859-1 and Windows-1252 are two-byte characters in UTF-8
-//                 + 0xC2 then second byte identical to the extended ASCII code.
-// - codes 192..255 in ISO-8859-1 and Windows-1252 are two-byte characters in UTF-8
-//                 + 0xC3 then second byte differs only in the first two bits to extended ASCII code.
-// - codes 128..159 in Windows-1252 are different, but usually only the €-symbol will be needed from this range.
-//                 + The euro symbol is 0x80 in Windows-1252, 0xa4 in ISO-8859-15, and 0xe2 0x82 0xac in UTF-8.
-//
-// Modified from original code at http://playground.arduino.cc/Main/Utf8ascii
-// Extended ASCII encoding should match the characters at http://www.ascii-code.com/
-//
-// Return "0" if a byte has to be ignored.
+// Characters in the Windows-1252 extended ASCII font that are not at their
+// Unicode code point. These are added as user defined characters using the
+// font data, so that the code point from the UTF-8 text finds them.
+const struct
 {
-  static uint8_t cPrev;
-  uint8_t c = '\0';
-
-  PRINTX("\nutf8Ascii 0x", ascii);
-
-  if (ascii < 0x7f)   // Standard ASCII-set 0..0x7F, no conversion
-  {
-    cPrev = '\0';
-    c = ascii;
-  }
-  else
-  {
-    switch (cPrev)  // Conversion depending on preceding UTF8-character
-    {
-    case 0xC2: c = ascii;  break;
-    case 0xC3: c = ascii | 0xC0;  break;
-    case 0x82: if (ascii==0xAC) c = 0x80; // Euro symbol special case
-    case 0xE2: 
-      switch (ascii)
-      {
-      case 0x80: c = 133;  break;// ellipsis special case
-      }
-      break;
-
-    default: PRINTS("!Unhandled! ");
-    }
-    cPrev = ascii;   // save last char
-  }
-
-  PRINTX(" -> 0x", c);
-
-  return(c);
-}
-
-void utf8Ascii(char* s)
-// In place conversion UTF-8 string to Extended ASCII
-// The extended ASCII string is always shorter.
+  uint16_t  code;   // Unicode code point
+  uint8_t   ascii;  // font character
+} extMap[] =
 {
-  uint8_t c;
-  char *cp = s;
+  { 0x20ac, 0x80 },   // euro symbol
+  { 0x2026, 133 },    // ellipsis
+};
 
-  PRINT("\nConverting: ", s);
+uint8_t extData[ARRAY_SIZE(extMap)][COL_SIZE + 1];  // user character data, width first
 
-  while (*s != '\0')
+void utf8Encode(char *s, uint16_t code)
+// Encode a code point below 0x800 as a UTF-8 string
+{
+  if (code < 0x80)
+    *s++ = code;
+  else
   {
-    c = utf8Ascii(*s++);
-    if (c != '\0')
-      *cp++ = c;
+    *s++ = 0xc0 | (code >> 6);
+    *s++ = 0x80 | (code & 0x3f);
   }
-  *cp = '\0';   // terminate the new string
+  *s = '\0';
 }
 
 void setup(void)
@@ -129,15 +90,19 @@ void setup(void)
 #endif
   PRINTS("\n[Parola UTF-8 display Test]");
 
-  // Do one time in-place conversion of the strings to be displayed
-  for (uint8_t i=0; i<ARRAY_SIZE(pc); i++)
-    utf8Ascii(pc[i]);
-
   // Initialise the Parola library
   P.begin();
   P.setInvert(false);
   P.setPause(PAUSE_TIME);
   P.setFont(ExtASCII);
+  P.setUTF8(true);
+
+  // Map the code points that are elsewhere in the font
+  for (uint8_t i=0; i<ARRAY_SIZE(extMap); i++)
+  {
+    extData[i][0] = P.getGraphicObject()->getChar(extMap[i].ascii, COL_SIZE, &extData[i][1]);
+    P.addChar(extMap[i].code, extData[i]);
+  }
 }
 
 void loop(void)
@@ -171,7 +136,8 @@ void loop(void)
     // show the list of characters in order
     char szMsg[20];
 
-    sprintf(szMsg, "%3d %c", idx, idx);
+    sprintf(szMsg, "%3d ", idx);
+    utf8Encode(&szMsg[4], idx);
     PRINT("\nC:", idx);
     PRINT(" - ", szMsg);
     P.print(szMsg);
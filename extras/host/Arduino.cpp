@@ -0,0 +1,116 @@
+/*
+MD_Parola host build - Arduino core stand-in
+
+See Arduino.h for comments
+
+Copyright (C) 2013 Marco Colli. All rights reserved.
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+#include <Arduino.h>
+#include <chrono>
+#include <thread>
+
+HostSerial Serial;
+
+static bool     _clockSet = false;  // clock stopped and set by hostSetMicros()
+static uint32_t _clockMicros = 0;   // current time while the clock is stopped
+static uint32_t _randState = 1;     // random() generator state
+
+static uint32_t clockMicros(void)
+{
+  static const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+  if (_clockSet)
+    return(_clockMicros);
+
+  return((uint32_t)std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count());
+}
+
+uint32_t micros(void) { return(clockMicros()); }
+
+uint32_t millis(void) { return(clockMicros() / 1000); }
+
+void hostSetMicros(uint32_t us) { _clockSet = true; _clockMicros = us; }
+
+void delay(uint32_t ms)
+{
+  if (_clockSet)
+    _clockMicros += ms * 1000;
+  else
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+long random(long howBig)
+{
+  if (howBig <= 0)
+    return(0);
+
+  _randState = _randState * 1103515245u + 12345u;
+  return((long)((_randState >> 16) % (uint32_t)howBig));
+}
+
+long random(long howSmall, long howBig)
+{
+  if (howSmall >= howBig)
+    return(howSmall);
+
+  return(howSmall + random(howBig - howSmall));
+}
+
+void randomSeed(unsigned long seed) { if (seed != 0) _randState = (uint32_t)seed; }
+
+size_t Print::write(const uint8_t *buffer, size_t size)
+{
+  size_t n = 0;
+
+  while (size--)
+  {
+    if (write(*buffer++) == 0)
+      break;
+    n++;
+  }
+
+  return(n);
+}
+
+size_t Print::print(long n, int base)
+{
+  if (base == DEC)
+  {
+    char sz[24];
+
+    snprintf(sz, sizeof(sz), "%ld", n);
+    return(write(sz));
+  }
+
+  return(print((unsigned long)n, base));
+}
+
+size_t Print::print(unsigned long n, int base)
+{
+  char sz[24];
+
+  snprintf(sz, sizeof(sz), (base == HEX ? "%lX" : "%lu"), n);
+  return(write(sz));
+}
+
+size_t Print::print(double n, int digits)
+{
+  char sz[40];
+
+  snprintf(sz, sizeof(sz), "%.*f", digits, n);
+  return(write(sz));
+}
@@ -0,0 +1,94 @@
+/*
+MD_Parola host build - Arduino core stand-in
+
+Provides the small part of the Arduino core used by the MD_Parola library
+so that it can be compiled and run on a workstation. See README.md in this
+folder for details.
+
+Copyright (C) 2013 Marco Colli. All rights reserved.
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <type_traits>
+
+typedef bool    boolean;
+typedef uint8_t byte;
+
+// Program memory is ordinary memory on the host
+#define PROGMEM
+#define F(s) (s)
+#define pgm_read_byte(p) (*(const uint8_t *)(p))
+#define pgm_read_word(p) (*(const uint16_t *)(p))
+#define pgm_read_ptr(p)  (*(void * const *)(p))
+
+#define DEC 10
+#define HEX 16
+
+template<class T, class U> inline typename std::common_type<T, U>::type min(T a, U b) { return(a < b ? a : b); }
+template<class T, class U> inline typename std::common_type<T, U>::type max(T a, U b) { return(a > b ? a : b); }
+
+// Time
+// millis() and micros() follow the workstation clock from program start.
+// Once hostSetMicros() is called the clock stops and only moves when it is
+// set again, so that animations can be stepped deterministically.
+uint32_t millis(void);
+uint32_t micros(void);
+void delay(uint32_t ms);
+void hostSetMicros(uint32_t us);
+
+// Pseudo random numbers, repeatable for the same seed
+long random(long howBig);
+long random(long howSmall, long howBig);
+void randomSeed(unsigned long seed);
+
+// Print class and Serial, written to stderr so that stdout is kept for
+// the output of host programs.
+class Print
+{
+public:
+  virtual ~Print(void) {}
+  virtual size_t write(uint8_t c) = 0;
+  virtual size_t write(const uint8_t *buffer, size_t size);
+  size_t write(const char *str) { return(str == nullptr ? 0 : write((const uint8_t *)str, strlen(str))); }
+
+  size_t print(const char *s) { return(write(s)); }
+  size_t print(char c) { return(write((uint8_t)c)); }
+  size_t print(long n, int base = DEC);
+  size_t print(unsigned long n, int base = DEC);
+  size_t print(int n, int base = DEC) { return(print((long)n, base)); }
+  size_t print(unsigned int n, int base = DEC) { return(print((unsigned long)n, base)); }
+  size_t print(double n, int digits = 2);
+
+  size_t println(void) { return(write("\n")); }
+  template<class T> size_t println(T v) { size_t n = print(v); return(n + println()); }
+  template<class T> size_t println(T v, int f) { size_t n = print(v, f); return(n + println()); }
+};
+
+class HostSerial : public Print
+{
+public:
+  void begin(unsigned long) {}
+  size_t write(uint8_t c) { return(fputc(c, stderr) == EOF ? 0 : 1); }
+  using Print::write;
+};
+
+extern HostSerial Serial;
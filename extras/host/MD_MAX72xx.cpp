@@ -0,0 +1,421 @@
+/*
+MD_Parola host build - in-memory MD_MAX72XX stand-in
+
+See MD_MAX72xx.h for comments
+
+Copyright (C) 2013 Marco Colli. All rights reserved.
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+#include <MD_MAX72xx.h>
+
+// Built-in font with the printable ASCII characters, in the version 1 file format.
+// Characters outside this range have no bitmap unless the application sets a font.
+static MD_MAX72XX::fontType_t _sysfont[] PROGMEM =
+{
+  'F', 1, 32, 126, 8,
+  2, 0, 0,	// 32 - 'Space'
+  1, 95,	// 33 - '!'
+  3, 7, 0, 7,	// 34 - '"'
+  5, 20, 127, 20, 127, 20,	// 35 - '#'
+  5, 36, 42, 127, 42, 18,	// 36 - '$'
+  5, 35, 19, 8, 100, 98,	// 37 - '%'
+  5, 54, 73, 86, 32, 80,	// 38 - '&'
+  2, 4, 3,	// 39 - '''
+  3, 28, 34, 65,	// 40 - '('
+  3, 65, 34, 28,	// 41 - ')'
+  5, 42, 28, 127, 28, 42,	// 42 - '*'
+  5, 8, 8, 62, 8, 8,	// 43 - '+'
+  2, 128, 96,	// 44 - ','
+  5, 8, 8, 8, 8, 8,	// 45 - '-'
+  2, 96, 96,	// 46 - '.'
+  5, 32, 16, 8, 4, 2,	// 47 - '/'
+  5, 62, 81, 73, 69, 62,	// 48 - '0'
+  3, 66, 127, 64,	// 49 - '1'
+  5, 114, 73, 73, 73, 70,	// 50 - '2'
+  5, 33, 65, 73, 77, 51,	// 51 - '3'
+  5, 24, 20, 18, 127, 16,	// 52 - '4'
+  5, 39, 69, 69, 69, 57,	// 53 - '5'
+  5, 60, 74, 73, 73, 49,	// 54 - '6'
+  5, 65, 33, 17, 9, 7,	// 55 - '7'
+  5, 54, 73, 73, 73, 54,	// 56 - '8'
+  5, 70, 73, 73, 41, 30,	// 57 - '9'
+  1, 20,	// 58 - ':'
+  2, 128, 104,	// 59 - ';'
+  4, 8, 20, 34, 65,	// 60 - '<'
+  5, 20, 20, 20, 20, 20,	// 61 - '='
+  4, 65, 34, 20, 8,	// 62 - '>'
+  5, 2, 1, 89, 9, 6,	// 63 - '?'
+  5, 62, 65, 93, 89, 78,	// 64 - '@'
+  5, 124, 18, 17, 18, 124,	// 65 - 'A'
+  5, 127, 73, 73, 73, 54,	// 66 - 'B'
+  5, 62, 65, 65, 65, 34,	// 67 - 'C'
+  5, 127, 65, 65, 65, 62,	// 68 - 'D'
+  5, 127, 73, 73, 73, 65,	// 69 - 'E'
+  5, 127, 9, 9, 9, 1,	// 70 - 'F'
+  5, 62, 65, 65, 81, 115,	// 71 - 'G'
+  5, 127, 8, 8, 8, 127,	// 72 - 'H'
+  3, 65, 127, 65,	// 73 - 'I'
+  5, 32, 64, 65, 63, 1,	// 74 - 'J'
+  5, 127, 8, 20, 34, 65,	// 75 - 'K'
+  5, 127, 64, 64, 64, 64,	// 76 - 'L'
+  5, 127, 2, 28, 2, 127,	// 77 - 'M'
+  5, 127, 4, 8, 16, 127,	// 78 - 'N'
+  5, 62, 65, 65, 65, 62,	// 79 - 'O'
+  5, 127, 9, 9, 9, 6,	// 80 - 'P'
+  5, 62, 65, 81, 33, 94,	// 81 - 'Q'
+  5, 127, 9, 25, 41, 70,	// 82 - 'R'
+  5, 38, 73, 73, 73, 50,	// 83 - 'S'
+  5, 3, 1, 127, 1, 3,	// 84 - 'T'
+  5, 63, 64, 64, 64, 63,	// 85 - 'U'
+  5, 31, 32, 64, 32, 31,	// 86 - 'V'
+  5, 63, 64, 56, 64, 63,	// 87 - 'W'
+  5, 99, 20, 8, 20, 99,	// 88 - 'X'
+  5, 3, 4, 120, 4, 3,	// 89 - 'Y'
+  5, 97, 89, 73, 77, 67,	// 90 - 'Z'
+  3, 127, 65, 65,	// 91 - '['
+  5, 2, 4, 8, 16, 32,	// 92 - 'backslash'
+  3, 65, 65, 127,	// 93 - ']'
+  5, 4, 2, 1, 2, 4,	// 94 - '^'
+  5, 64, 64, 64, 64, 64,	// 95 - '_'
+  2, 3, 4,	// 96 - '`'
+  5, 32, 84, 84, 120, 64,	// 97 - 'a'
+  5, 127, 40, 68, 68, 56,	// 98 - 'b'
+  5, 56, 68, 68, 68, 40,	// 99 - 'c'
+  5, 56, 68, 68, 40, 127,	// 100 - 'd'
+  5, 56, 84, 84, 84, 24,	// 101 - 'e'
+  4, 8, 126, 9, 2,	// 102 - 'f'
+  5, 24, 164, 164, 156, 120,	// 103 - 'g'
+  5, 127, 8, 4, 4, 120,	// 104 - 'h'
+  3, 68, 125, 64,	// 105 - 'i'
+  4, 64, 128, 128, 122,	// 106 - 'j'
+  4, 127, 16, 40, 68,	// 107 - 'k'
+  3, 65, 127, 64,	// 108 - 'l'
+  5, 124, 4, 120, 4, 120,	// 109 - 'm'
+  5, 124, 8, 4, 4, 120,	// 110 - 'n'
+  5, 56, 68, 68, 68, 56,	// 111 - 'o'
+  5, 252, 24, 36, 36, 24,	// 112 - 'p'
+  5, 24, 36, 36, 24, 252,	// 113 - 'q'
+  5, 124, 8, 4, 4, 8,	// 114 - 'r'
+  5, 72, 84, 84, 84, 36,	// 115 - 's'
+  4, 4, 63, 68, 36,	// 116 - 't'
+  5, 60, 64, 64, 32, 124,	// 117 - 'u'
+  5, 28, 32, 64, 32, 28,	// 118 - 'v'
+  5, 60, 64, 48, 64, 60,	// 119 - 'w'
+  5, 68, 40, 16, 40, 68,	// 120 - 'x'
+  5, 76, 144, 144, 144, 124,	// 121 - 'y'
+  5, 68, 100, 84, 76, 68,	// 122 - 'z'
+  3, 8, 54, 65,	// 123 - '{'
+  1, 119,	// 124 - '|'
+  3, 65, 54, 8,	// 125 - '}'
+  5, 2, 1, 2, 4, 2,	// 126 - '~'
+};
+
+MD_MAX72XX::MD_MAX72XX(moduleType_t mod, uint8_t dataPin, uint8_t clkPin, uint8_t csPin, uint8_t numDevices) :
+MD_MAX72XX(mod, csPin, numDevices)
+{
+  (void)dataPin;
+  (void)clkPin;
+}
+
+MD_MAX72XX::MD_MAX72XX(moduleType_t mod, uint8_t csPin, uint8_t numDevices) :
+_maxDevices(numDevices), _matrix(nullptr), _intensity(nullptr), _shutdown(nullptr),
+_updateEnabled(true), _wrapAround(false), _updateCount(0), _fontData(nullptr),
+_fontFirst(0), _fontLast(0), _fontHeight(0), _fontMaxWidth(0), _fontChars(nullptr),
+_fontIndex(nullptr)
+{
+  (void)mod;
+  (void)csPin;
+}
+
+MD_MAX72XX::~MD_MAX72XX(void)
+{
+  delete [] _matrix;
+  delete [] _intensity;
+  delete [] _shutdown;
+  delete [] _fontIndex;
+}
+
+void MD_MAX72XX::begin(void)
+{
+  if (_matrix == nullptr)
+  {
+    _matrix = new uint8_t[getColumnCount()];
+    _intensity = new uint8_t[_maxDevices];
+    _shutdown = new bool[_maxDevices];
+  }
+
+  for (uint8_t i = 0; i < _maxDevices; i++)
+  {
+    _intensity[i] = MAX_INTENSITY / 2;
+    _shutdown[i] = false;
+  }
+
+  setFont(nullptr);
+  clear();
+}
+
+bool MD_MAX72XX::control(uint8_t startDev, uint8_t endDev, controlRequest_t mode, int value)
+{
+  if (_matrix == nullptr || endDev < startDev || endDev >= _maxDevices)
+    return(false);
+
+  switch (mode)
+  {
+  case UPDATE:
+    _updateEnabled = (value == ON);
+    if (_updateEnabled) _updateCount++;
+    break;
+
+  case WRAPAROUND:
+    _wrapAround = (value == ON);
+    break;
+
+  case SHUTDOWN:
+    for (uint8_t i = startDev; i <= endDev; i++)
+      _shutdown[i] = (value == ON);
+    break;
+
+  case INTENSITY:
+    for (uint8_t i = startDev; i <= endDev; i++)
+      _intensity[i] = (uint8_t)(value > MAX_INTENSITY ? MAX_INTENSITY : value);
+    break;
+
+  default:  // SCANLIMIT, TEST and DECODE have no visible effect here
+    break;
+  }
+
+  return(true);
+}
+
+bool MD_MAX72XX::clear(uint8_t startDev, uint8_t endDev)
+{
+  if (_matrix == nullptr || endDev < startDev || endDev >= _maxDevices)
+    return(false);
+
+  memset(_matrix + (startDev * COL_SIZE), 0, (endDev - startDev + 1) * COL_SIZE);
+  changed();
+
+  return(true);
+}
+
+uint8_t MD_MAX72XX::getColumn(uint16_t c)
+{
+  if (_matrix == nullptr || c >= getColumnCount())
+    return(0);
+
+  return(_matrix[c]);
+}
+
+bool MD_MAX72XX::setColumn(uint16_t c, uint8_t value)
+{
+  if (_matrix == nullptr || c >= getColumnCount())
+    return(false);
+
+  _matrix[c] = value;
+  changed();
+
+  return(true);
+}
+
+bool MD_MAX72XX::getPoint(uint8_t r, uint16_t c)
+{
+  if (r >= ROW_SIZE)
+    return(false);
+
+  return((getColumn(c) & (1 << r)) != 0);
+}
+
+bool MD_MAX72XX::setPoint(uint8_t r, uint16_t c, bool state)
+{
+  if (r >= ROW_SIZE || c >= getColumnCount())
+    return(false);
+
+  uint8_t v = getColumn(c);
+
+  return(setColumn(c, state ? v | (1 << r) : v & ~(1 << r)));
+}
+
+bool MD_MAX72XX::transform(uint8_t startDev, uint8_t endDev, transformType_t ttype)
+{
+  if (_matrix == nullptr || endDev < startDev || endDev >= _maxDevices)
+    return(false);
+
+  uint8_t *p = _matrix + (startDev * COL_SIZE);
+  uint16_t n = (endDev - startDev + 1) * COL_SIZE;
+  uint8_t t;
+
+  switch (ttype)
+  {
+  case TSL:   // column 0 is on the right, so left is towards the higher columns
+    t = p[n - 1];
+    memmove(p + 1, p, n - 1);
+    p[0] = (_wrapAround ? t : 0);
+    break;
+
+  case TSR:
+    t = p[0];
+    memmove(p, p + 1, n - 1);
+    p[n - 1] = (_wrapAround ? t : 0);
+    break;
+
+  case TSU:
+    for (uint16_t i = 0; i < n; i++)
+      p[i] = (p[i] >> 1) | (_wrapAround ? (uint8_t)(p[i] << (ROW_SIZE - 1)) : 0);
+    break;
+
+  case TSD:
+    for (uint16_t i = 0; i < n; i++)
+      p[i] = (uint8_t)(p[i] << 1) | (_wrapAround ? (p[i] >> (ROW_SIZE - 1)) : 0);
+    break;
+
+  case TFLR:
+    for (uint16_t i = 0; i < n / 2; i++)
+    {
+      t = p[i];
+      p[i] = p[n - 1 - i];
+      p[n - 1 - i] = t;
+    }
+    break;
+
+  case TFUD:
+    for (uint16_t i = 0; i < n; i++)
+    {
+      t = 0;
+      for (uint8_t b = 0; b < ROW_SIZE; b++)
+        if (p[i] & (1 << b)) t |= (1 << (ROW_SIZE - 1 - b));
+      p[i] = t;
+    }
+    break;
+
+  case TRC:   // each device is rotated on its own
+    for (uint8_t d = 0; d <= endDev - startDev; d++)
+    {
+      uint8_t *m = p + (d * COL_SIZE);
+      uint8_t r[COL_SIZE] = { 0 };
+
+      for (uint8_t c = 0; c < COL_SIZE; c++)
+        for (uint8_t b = 0; b < ROW_SIZE; b++)
+          if (m[c] & (1 << b)) r[b] |= (1 << (COL_SIZE - 1 - c));
+      memcpy(m, r, COL_SIZE);
+    }
+    break;
+
+  case TINV:
+    for (uint16_t i = 0; i < n; i++)
+      p[i] = ~p[i];
+    break;
+  }
+
+  changed();
+
+  return(true);
+}
+
+bool MD_MAX72XX::setFont(fontType_t *f)
+// Parse the font header and index the characters. The library sets the font
+// for its zone before every character, so nothing is done if it is unchanged.
+{
+  fontType_t *p = (f == nullptr ? _sysfont : f);
+
+  if (_fontIndex != nullptr && f == _fontData)
+    return(true);
+
+  _fontData = f;
+  _fontHeight = ROW_SIZE;
+
+  if (pgm_read_byte(p) == 'F' && pgm_read_byte(p + 1) == 1)
+  {
+    _fontFirst = pgm_read_byte(p + 2);
+    _fontLast = pgm_read_byte(p + 3);
+    _fontHeight = pgm_read_byte(p + 4);
+    _fontChars = p + 5;
+  }
+  else if (pgm_read_byte(p) == 'F' && pgm_read_byte(p + 1) == 2)
+  {
+    _fontFirst = (pgm_read_byte(p + 2) << 8) | pgm_read_byte(p + 3);
+    _fontLast = (pgm_read_byte(p + 4) << 8) | pgm_read_byte(p + 5);
+    _fontHeight = pgm_read_byte(p + 6);
+    _fontChars = p + 7;
+  }
+  else    // no header, 256 characters
+  {
+    _fontFirst = 0;
+    _fontLast = 255;
+    _fontChars = p;
+  }
+
+  // index the characters and find the widest one
+  uint32_t count = (_fontLast >= _fontFirst ? _fontLast - _fontFirst + 1 : 0);
+  uint32_t offset = 0;
+
+  delete [] _fontIndex;
+  _fontIndex = new uint32_t[count + 1];
+  _fontMaxWidth = 0;
+  for (uint32_t i = 0; i < count; i++)
+  {
+    uint8_t w = pgm_read_byte(_fontChars + offset);
+
+    _fontIndex[i] = offset;
+    if (w > _fontMaxWidth) _fontMaxWidth = w;
+    offset += w + 1;
+  }
+
+  return(true);
+}
+
+uint8_t MD_MAX72XX::getChar(uint16_t c, uint8_t size, uint8_t *buf)
+{
+  int32_t offset = fontCharOffset(c);
+
+  if (buf == nullptr)
+    return(0);
+
+  if (offset == -1)
+  {
+    memset(buf, 0, size);
+    return(0);
+  }
+
+  fontType_t *p = _fontChars + offset;
+  uint8_t w = pgm_read_byte(p++);
+
+  if (w > size) w = size;
+  for (uint8_t i = 0; i < w; i++)
+    buf[i] = pgm_read_byte(p++);
+
+  return(w);
+}
+
+uint8_t MD_MAX72XX::setChar(uint16_t col, uint16_t c)
+{
+  uint8_t buf[COL_SIZE * 4];
+  uint8_t w = getChar(c, sizeof(buf), buf);
+
+  for (uint8_t i = 0; i < w; i++)
+    if (col >= i) setColumn(col - i, buf[i]);
+
+  return(w);
+}
+
+void MD_MAX72XX::dump(FILE *f)
+{
+  for (uint8_t r = 0; r < ROW_SIZE; r++)
+  {
+    for (int32_t c = getColumnCount() - 1; c >= 0; c--)
+      fputc(getPoint(r, c) ? '#' : '.', f);
+    fputc('\n', f);
+  }
+}
@@ -0,0 +1,146 @@
+/*
+MD_Parola host build - in-memory MD_MAX72XX stand-in
+
+Implements the part of the MD_MAX72XX interface used by the MD_Parola library
+and its examples against a display buffer held in memory, so the library can
+be compiled and run on a workstation. See README.md in this folder for details.
+
+Copyright (C) 2013 Marco Colli. All rights reserved.
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+#pragma once
+
+#include <Arduino.h>
+
+#define COL_SIZE  8     ///< Number of columns in a module
+#define ROW_SIZE  8     ///< Number of rows in a module
+#define MAX_INTENSITY 0xf ///< The maximum intensity value that can be set for a LED array
+#define MAX_SCANLIMIT 7   ///< The maximum scan limit value that can be set for the devices
+
+class MD_MAX72XX
+{
+public:
+  enum moduleType_t
+  {
+    GENERIC_HW,     ///< Use 'generic' style hardware modules commonly available.
+    FC16_HW,        ///< Use FC-16 style hardware module.
+    PAROLA_HW,      ///< Use the Parola style hardware modules.
+    ICSTATION_HW,   ///< Use ICStation style hardware module.
+    DR0CR0RR0_HW, DR0CR0RR1_HW, DR0CR1RR0_HW, DR0CR1RR1_HW,
+    DR1CR0RR0_HW, DR1CR0RR1_HW, DR1CR1RR0_HW, DR1CR1RR1_HW
+  };
+
+  enum controlRequest_t
+  {
+    SHUTDOWN = 0,   ///< Shut down the MAX72XX. Requires ON/OFF value.
+    SCANLIMIT = 1,  ///< Set the scan limit for the MAX72XX. Requires numeric value [0..MAX_SCANLIMIT].
+    INTENSITY = 2,  ///< Set the LED intensity for the MAX72XX. Requires numeric value [0..MAX_INTENSITY].
+    TEST = 3,       ///< Set the MAX72XX in test mode. Requires ON/OFF value.
+    DECODE = 4,     ///< Set the MAX72XX 7 segment decode mode. Requires ON/OFF value.
+    UPDATE = 10,    ///< Enable or disable auto updates of the devices from the library. Requires ON/OFF value.
+    WRAPAROUND = 11 ///< Enable or disable wraparound when shifting (circular buffer). Requires ON/OFF value.
+  };
+
+  enum controlValue_t
+  {
+    OFF = 0,  ///< General OFF status request
+    ON = 1    ///< General ON status request
+  };
+
+  enum transformType_t
+  {
+    TSL,  ///< Transform Shift Left one pixel element
+    TSR,  ///< Transform Shift Right one pixel element
+    TSU,  ///< Transform Shift Up one pixel element
+    TSD,  ///< Transform Shift Down one pixel element
+    TFLR, ///< Transform Flip Left to Right
+    TFUD, ///< Transform Flip Up to Down
+    TRC,  ///< Transform Rotate Clockwise 90 degrees
+    TINV  ///< Transform INVert (pixels inverted)
+  };
+
+  typedef const uint8_t fontType_t;   ///< Font data is a byte array, same format as MD_MAX72XX
+
+  // Constructors. The pin numbers and hardware type are ignored.
+  MD_MAX72XX(moduleType_t mod, uint8_t dataPin, uint8_t clkPin, uint8_t csPin, uint8_t numDevices = 1);
+  MD_MAX72XX(moduleType_t mod, uint8_t csPin, uint8_t numDevices = 1);
+  ~MD_MAX72XX(void);
+
+  void begin(void);
+
+  // Device control
+  bool control(uint8_t dev, controlRequest_t mode, int value) { return(control(dev, dev, mode, value)); }
+  void control(controlRequest_t mode, int value) { control(0, getDeviceCount() - 1, mode, value); }
+  bool control(uint8_t startDev, uint8_t endDev, controlRequest_t mode, int value);
+
+  uint8_t getDeviceCount(void) { return(_maxDevices); }
+  uint16_t getColumnCount(void) { return(_maxDevices * COL_SIZE); }
+
+  void update(controlValue_t mode) { control(UPDATE, mode); }
+  void update(void) { _updateCount++; }
+  void wraparound(controlValue_t mode) { control(WRAPAROUND, mode); }
+
+  // Display buffer. Column 0 is the rightmost column of device 0, row 0 is the top row.
+  void clear(void) { clear(0, getDeviceCount() - 1); }
+  bool clear(uint8_t startDev, uint8_t endDev);
+  bool clear(uint8_t buf) { return(clear(buf, buf)); }
+
+  uint8_t getColumn(uint16_t c);
+  uint8_t getColumn(uint8_t buf, uint8_t c) { return(c < COL_SIZE ? getColumn((uint16_t)(buf * COL_SIZE + c)) : 0); }
+  bool setColumn(uint16_t c, uint8_t value);
+  bool setColumn(uint8_t buf, uint8_t c, uint8_t value) { return(c < COL_SIZE ? setColumn((uint16_t)(buf * COL_SIZE + c), value) : false); }
+
+  bool getPoint(uint8_t r, uint16_t c);
+  bool setPoint(uint8_t r, uint16_t c, bool state);
+
+  bool transform(transformType_t ttype) { return(transform(0, getDeviceCount() - 1, ttype)); }
+  bool transform(uint8_t startDev, uint8_t endDev, transformType_t ttype);
+
+  // Fonts. The MD_MAX72XX file formats without header, version 1 and version 2 are
+  // understood. Setting a nullptr font selects the built-in printable ASCII font.
+  bool setFont(fontType_t *f);
+  fontType_t *getFont(void) { return(_fontData); }
+  uint8_t getMaxFontWidth(void) { return(_fontMaxWidth); }
+  uint8_t getFontHeight(void) { return(_fontHeight); }
+  uint8_t getChar(uint16_t c, uint8_t size, uint8_t *buf);
+  uint8_t setChar(uint16_t col, uint16_t c);
+
+  // Host only - inspection of the simulated devices
+  uint8_t getIntensity(uint8_t dev) { return(dev < _maxDevices ? _intensity[dev] : 0); }
+  bool isShutdown(uint8_t dev) { return(dev < _maxDevices ? _shutdown[dev] : true); }
+  uint32_t getUpdateCount(void) { return(_updateCount); }  // number of times the devices would have been written
+  void dump(FILE *f);   // draw the display as text, one line per row
+
+private:
+  uint8_t   _maxDevices;    // number of devices in the chain
+  uint8_t   *_matrix;       // display buffer, COL_SIZE bytes per device
+  uint8_t   *_intensity;    // intensity per device
+  bool      *_shutdown;     // shutdown state per device
+  bool      _updateEnabled; // auto update after every change
+  bool      _wrapAround;    // shifted out columns come back in the other side
+  uint32_t  _updateCount;   // number of simulated device updates
+
+  fontType_t *_fontData;    // current font data
+  uint16_t  _fontFirst;     // first character in the font
+  uint16_t  _fontLast;      // last character in the font
+  uint8_t   _fontHeight;    // height of the font
+  uint8_t   _fontMaxWidth;  // widest character in the font
+  fontType_t *_fontChars;   // start of the character data
+  uint32_t  *_fontIndex;    // offset of each character from _fontChars
+
+  void changed(void) { if (_updateEnabled) _updateCount++; }
+  int32_t fontCharOffset(uint16_t c) { return(_fontIndex == nullptr || c < _fontFirst || c > _fontLast ? -1 : (int32_t)_fontIndex[c - _fontFirst]); }
+};
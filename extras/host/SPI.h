@@ -0,0 +1,9 @@
+/*
+MD_Parola host build - SPI stand-in
+
+The in-memory MD_MAX72XX does not use SPI. This header only exists so that
+sketches including <SPI.h> compile on the host.
+ */
+#pragma once
+
+#include <Arduino.h>
@@ -0,0 +1,324 @@
+/*
+MD_Parola host build - text effect frame cost benchmark
+
+Every text effect is run in and out for each text alignment, in normal,
+inverted and flipped mode, over zone widths from 1 to 64 modules and a range
+of message lengths. One CSV line is written to stdout for each complete
+animation cycle so that results can be captured and compared between
+library versions.
+
+Columns are the effect, alignment, display mode, zone width (modules), message
+length (characters), frames in the full cycle, min/avg/max time per frame (ns),
+time for all the frames in the cycle (ns), the peak heap used by the display
+during the cycle (bytes, from the start of the cycle with the display created)
+and the peak stack used by the library calls during the cycle (bytes).
+
+Each cycle runs on a thread with its own stack, which is filled with a known
+pattern before the thread starts. The stack used is the distance from the
+cycle function's frame to the deepest byte that no longer holds the pattern.
+It is measured with the host compiler and only indicates the relative depth
+of the effects on a microcontroller.
+
+The clock seen by the library is stopped and advanced by one millisecond before
+every call to displayAnimate(), so each cycle runs the same frames every time.
+Frame times are measured with the workstation clock.
+
+Usage: parola_benchmark [repeat]
+  repeat - number of times each cycle is run, the fastest time per frame is kept
+           (default 1)
+
+Copyright (C) 2013 Marco Colli. All rights reserved.
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+#include <MD_Parola.h>
+#include <chrono>
+#include <new>
+#include <pthread.h>
+
+// Heap measurement.
+// Every allocation is made with a size header so that the bytes in use, and
+// the highest value reached, can be kept.
+static size_t heapUsed = 0;   // bytes allocated now
+static size_t heapPeak = 0;   // most bytes allocated since the last reset
+
+void *operator new(size_t size)
+{
+  size_t *p = (size_t *)malloc(size + sizeof(max_align_t));
+
+  if (p == nullptr)
+    throw std::bad_alloc();
+
+  *p = size;
+  heapUsed += size;
+  if (heapUsed > heapPeak) heapPeak = heapUsed;
+
+  return((uint8_t *)p + sizeof(max_align_t));
+}
+
+void operator delete(void *ptr) noexcept
+{
+  if (ptr == nullptr)
+    return;
+
+  size_t *p = (size_t *)((uint8_t *)ptr - sizeof(max_align_t));
+
+  heapUsed -= *p;
+  free(p);
+}
+
+void *operator new[](size_t size) { return(operator new(size)); }
+void operator delete[](void *ptr) noexcept { operator delete(ptr); }
+void operator delete(void *ptr, size_t) noexcept { operator delete(ptr); }
+void operator delete[](void *ptr, size_t) noexcept { operator delete(ptr); }
+
+// Benchmark data
+struct sEffect
+{
+  textEffect_t  effect;   // text effect to measure
+  const char *  name;     // name printed in the results
+};
+
+static const sEffect effects[] =
+{
+  { PA_PRINT, "PRINT" },
+  { PA_SCROLL_UP, "SCROLL_UP" },
+  { PA_SCROLL_DOWN, "SCROLL_DOWN" },
+  { PA_SCROLL_LEFT, "SCROLL_LEFT" },
+  { PA_SCROLL_RIGHT, "SCROLL_RIGHT" },
+#if ENA_SPRITE
+  { PA_SPRITE, "SPRITE" },
+#endif
+#if ENA_MISC
+  { PA_SLICE, "SLICE" },
+  { PA_MESH, "MESH" },
+  { PA_FADE, "FADE" },
+  { PA_DISSOLVE, "DISSOLVE" },
+  { PA_BLINDS, "BLINDS" },
+#endif
+#if ENA_RANDOM
+  { PA_RANDOM, "RANDOM" },
+#endif
+#if ENA_WIPE
+  { PA_WIPE, "WIPE" },
+  { PA_WIPE_CURSOR, "WIPE_CURSOR" },
+#endif
+#if ENA_SCAN
+  { PA_SCAN_HORIZ, "SCAN_HORIZ" },
+  { PA_SCAN_HORIZX, "SCAN_HORIZX" },
+  { PA_SCAN_VERT, "SCAN_VERT" },
+  { PA_SCAN_VERTX, "SCAN_VERTX" },
+#endif
+#if ENA_OPNCLS
+  { PA_OPENING, "OPENING" },
+  { PA_OPENING_CURSOR, "OPENING_CURSOR" },
+  { PA_CLOSING, "CLOSING" },
+  { PA_CLOSING_CURSOR, "CLOSING_CURSOR" },
+#endif
+#if ENA_SCR_DIA
+  { PA_SCROLL_UP_LEFT, "SCROLL_UP_LEFT" },
+  { PA_SCROLL_UP_RIGHT, "SCROLL_UP_RIGHT" },
+  { PA_SCROLL_DOWN_LEFT, "SCROLL_DOWN_LEFT" },
+  { PA_SCROLL_DOWN_RIGHT, "SCROLL_DOWN_RIGHT" },
+#endif
+#if ENA_GROW
+  { PA_GROW_UP, "GROW_UP" },
+  { PA_GROW_DOWN, "GROW_DOWN" },
+#endif
+};
+
+static const textPosition_t align[] = { PA_LEFT, PA_CENTER, PA_RIGHT };
+static const char *alignName[] = { "LEFT", "CENTER", "RIGHT" };
+
+static const char *modeName[] = { "NORMAL", "INVERT", "FLIP" };
+
+static const uint8_t zoneWidth[] = { 1, 2, 4, 8, 16, 32, 64 };
+
+static const char *message[] = { "Hi", "Parola", "Frame cost benchmark message" };
+
+// Sprite Definitions
+static const uint8_t F_PMAN1 = 6;
+static const uint8_t W_PMAN1 = 8;
+static const uint8_t PROGMEM pacman1[F_PMAN1 * W_PMAN1] =  // gobbling pacman animation
+{
+  0x00, 0x81, 0xc3, 0xe7, 0xff, 0x7e, 0x7e, 0x3c,
+  0x00, 0x42, 0xe7, 0xe7, 0xff, 0xff, 0x7e, 0x3c,
+  0x24, 0x66, 0xe7, 0xff, 0xff, 0xff, 0x7e, 0x3c,
+  0x3c, 0x7e, 0xff, 0xff, 0xff, 0xff, 0x7e, 0x3c,
+  0x24, 0x66, 0xe7, 0xff, 0xff, 0xff, 0x7e, 0x3c,
+  0x00, 0x42, 0xe7, 0xe7, 0xff, 0xff, 0x7e, 0x3c,
+};
+
+struct sResult
+{
+  uint32_t frames;    // frames in the cycle
+  uint64_t tMin;      // fastest frame (ns)
+  uint64_t tMax;      // slowest frame (ns)
+  uint64_t tTotal;    // all frames (ns)
+  size_t   heap;      // peak heap bytes
+  size_t   stack;     // peak stack bytes
+};
+
+// Stack measurement.
+// The cycle thread runs on stackBuf, painted with STACK_PAINT before it starts.
+static const size_t STACK_SIZE = 256 * 1024;  // bytes of stack for the cycle thread
+static const uint8_t STACK_PAINT = 0xa5;      // pattern for unused stack
+static uint8_t *stackBuf = nullptr;           // stack for the cycle thread
+static uintptr_t stackTop = 0;                // address in the cycle function's frame
+
+struct sCycle
+{
+  uint8_t e, a, mode, width, m; // cycle parameters
+  sResult r;                    // cycle results
+};
+
+static uint64_t now(void)
+{
+  return(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+static sResult runCycle(uint8_t e, uint8_t a, uint8_t mode, uint8_t width, uint8_t m)
+// Run one complete in and out animation on a new display
+{
+  sResult r = { 0, UINT64_MAX, 0, 0, 0, 0 };
+  uint32_t clock = 0;
+  size_t heapStart = heapUsed;
+
+  heapPeak = heapUsed;
+  hostSetMicros(clock);
+
+  MD_Parola P(MD_MAX72XX::FC16_HW, 10, width);
+
+  P.begin();
+#if ENA_SPRITE
+  P.setSpriteData(pacman1, W_PMAN1, F_PMAN1, pacman1, W_PMAN1, F_PMAN1);
+#endif
+  P.setInvert(mode == 1);
+  P.setZoneEffect(0, mode == 2, PA_FLIP_UD);
+  P.setZoneEffect(0, mode == 2, PA_FLIP_LR);
+  P.displayText(message[m], align[a], 1, 0, effects[e].effect, effects[e].effect);
+
+  // the library calls use the stack below this point
+  volatile uint8_t mark = 0;
+  stackTop = (uintptr_t)&mark;
+
+  while (true)
+  {
+    clock += 1000;
+    hostSetMicros(clock);
+
+    uint64_t t = now();
+    bool b = P.displayAnimate();
+
+    t = now() - t;
+    if (P.isAnimationAdvanced())
+    {
+      r.frames++;
+      r.tTotal += t;
+      if (t < r.tMin) r.tMin = t;
+      if (t > r.tMax) r.tMax = t;
+    }
+    if (b) break;
+  }
+
+  r.heap = heapPeak - heapStart;
+  if (r.frames == 0) r.tMin = 0;
+
+  return(r);
+}
+
+static void *cycleThread(void *arg)
+{
+  sCycle *c = (sCycle *)arg;
+
+  c->r = runCycle(c->e, c->a, c->mode, c->width, c->m);
+
+  return(nullptr);
+}
+
+static sResult runCycleThread(uint8_t e, uint8_t a, uint8_t mode, uint8_t width, uint8_t m)
+// Run one cycle on a painted stack and measure the deepest stack use
+{
+  sCycle c = { e, a, mode, width, m, { 0, 0, 0, 0, 0, 0 } };
+  pthread_attr_t attr;
+  pthread_t t;
+  size_t i = 0;
+
+  memset(stackBuf, STACK_PAINT, STACK_SIZE);
+  pthread_attr_init(&attr);
+  pthread_attr_setstack(&attr, stackBuf, STACK_SIZE);
+  if (pthread_create(&t, &attr, cycleThread, &c) != 0)
+  {
+    fprintf(stderr, "Cannot start the cycle thread\n");
+    exit(1);
+  }
+  pthread_join(t, nullptr);
+  pthread_attr_destroy(&attr);
+
+  // the stack grows down, find the lowest byte written
+  while (i < STACK_SIZE && stackBuf[i] == STACK_PAINT)
+    i++;
+  c.r.stack = stackTop - (uintptr_t)&stackBuf[i];
+
+  return(c.r);
+}
+
+int main(int argc, char *argv[])
+{
+  int repeat = (argc > 1 ? atoi(argv[1]) : 1);
+
+  if (repeat < 1) repeat = 1;
+
+  if (posix_memalign((void **)&stackBuf, 4096, STACK_SIZE) != 0)
+  {
+    fprintf(stderr, "Cannot allocate the cycle thread stack\n");
+    return(1);
+  }
+
+  printf("effect,align,mode,modules,length,frames,frame_min_ns,frame_avg_ns,frame_max_ns,cycle_ns,heap_bytes,stack_bytes\n");
+
+  // The first use of the workstation clock sets up its own data, using more
+  // stack than later calls. One cycle is run first so that this does not
+  // show in the results.
+  runCycleThread(0, 0, 0, 1, 0);
+
+  for (uint8_t w = 0; w < ARRAY_SIZE(zoneWidth); w++)
+    for (uint8_t m = 0; m < ARRAY_SIZE(message); m++)
+      for (uint8_t e = 0; e < ARRAY_SIZE(effects); e++)
+        for (uint8_t a = 0; a < ARRAY_SIZE(align); a++)
+          for (uint8_t mode = 0; mode < ARRAY_SIZE(modeName); mode++)
+          {
+            sResult best = runCycleThread(e, a, mode, zoneWidth[w], m);
+
+            for (int i = 1; i < repeat; i++)
+            {
+              sResult r = runCycleThread(e, a, mode, zoneWidth[w], m);
+
+              if (r.tTotal < best.tTotal) best = r;
+            }
+
+            printf("%s,%s,%s,%u,%u,%u,%llu,%llu,%llu,%llu,%u,%u\n",
+              effects[e].name, alignName[a], modeName[mode], zoneWidth[w],
+              (unsigned)strlen(message[m]), best.frames,
+              (unsigned long long)best.tMin,
+              (unsigned long long)(best.frames ? best.tTotal / best.frames : 0),
+              (unsigned long long)best.tMax, (unsigned long long)best.tTotal,
+              (unsigned)best.heap, (unsigned)best.stack);
+          }
+
+  free(stackBuf);
+
+  return(0);
+}
@@ -28,38 +28,376 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
  */
 
 MD_PZone::MD_PZone(void) :
-_MX(nullptr), _suspend(false), _lastRunTime(0),
-_fsmState(END), _scrollDistance(0), _zoneEffect(0), _pText(nullptr), 
-_userChars(nullptr), _cBufSize(0), _cBuf(nullptr), _charSpacing(1), 
-_fontDef(nullptr)
+_MX(nullptr), _suspend(false), _lastRunTime(0), _timingMode(PA_TIMING_FREE),
+#if ENA_QUEUE
+_qHead(0), _qCount(0), _queueOverflow(PA_QUEUE_REJECT),
+#endif
+_fsmState(END), _moveIn(true), _scrollDistance(0), _zoneEffect(0), 
+_zoneStart(0), _zoneEnd(0), _colStart(0), _colEnd(0), _frame(nullptr), _frameSize(0), _shadow(nullptr), _shadowValid(false),
+#if ENA_CANVAS
+_zoneRows(1), _rowBase(0), _rowWidth(0), _rowFlip(false), _colMask(0xff), _textShift(0), _fBuf(nullptr),
+#endif
+_pText(nullptr), _textPool(nullptr), _textPoolSize(0), _utf8(false), _cbText(nullptr), _cbEffect(nullptr), _nextCode(0),
+_userChars(nullptr), _userCharCount(0), _userCharSize(0), _cBufSize(0), _cBuf(nullptr), _charSpacing(1), 
+_fontDef(nullptr), _tCache(nullptr), _tCacheSize(0), _tCacheValid(false)
+#if ENA_RANDOM
+, _randState(1), _randCount(0), _randRate(1)
+#endif
 #if ENA_SPRITE
 , _spriteInData(nullptr), _spriteOutData(nullptr)
 #endif
+, _modEffect(PA_NO_EFFECT), _modStep(0), _modIn(true), _modHold(false), _stageMask(~(colData_t)0), _stageIntensity(0xff)
 {
 };
 
 MD_PZone::~MD_PZone(void)
 {
   // release the memory for user defined characters
-  charDef_t *p = _userChars;
+  delete[] _userChars;
 
-  while (p != nullptr)
-  {
-    charDef_t *pt = p;
-    p = pt->next;
-    delete pt;
-  };
-
-  // release memory for the character buffer
+  // release memory for the character buffer, text cache and frame buffer
   delete[] _cBuf;
+  delete[] _tCache;
+  delete[] _frame;
+  delete[] _shadow;
+#if ENA_CANVAS
+  delete[] _fBuf;
+#endif
 }
 
 void MD_PZone::begin(MD_MAX72XX *p)
 {
   _MX = p;
   allocateFontBuffer();
+#if ENA_STATS
+  resetZoneStats();
+  _cycleStartTime = 0;
+#endif
+}
+
+bool MD_PZone::setZoneColumns(uint16_t cStart, uint16_t cEnd)
+// Set the zone limits and allocate the frame buffer to match.
+// The module limits are the modules that contain the columns. Zones
+// reaching past the last MD_MAX72XX device number are rejected.
+{
+#if ENA_CANVAS
+  return(setZoneRect(cStart, cEnd, 0, 0, 0, false));
+#else
+  if ((cStart > cEnd) || (cEnd > ZONE_END_COL(MAX_MODULES - 1)))
+    return(false);
+
+  _colStart = cStart;
+  _colEnd = cEnd;
+  _zoneStart = cStart / COL_SIZE;
+  _zoneEnd = cEnd / COL_SIZE;
+
+  allocateFrame();
+
+  return(true);
+#endif
+}
+
+#if ENA_CANVAS
+bool MD_PZone::setZoneRect(uint16_t cStart, uint16_t cEnd, uint8_t rStart, uint8_t rEnd, uint16_t rowWidth, bool rowFlip)
+// Set the zone limits for a rectangle of the canvas. The module limits
+// are the lowest and highest modules that contain any of the zone. Zones
+// reaching past the last MD_MAX72XX device number are rejected.
+{
+  // highest display column used, in the top row of the zone
+  uint32_t last = (uint32_t)rEnd * rowWidth + ((rowFlip && (rEnd & 1)) ? rowWidth - 1 - cStart : cEnd);
+
+  if ((cStart > cEnd) || (rStart > rEnd) || (rowWidth != 0 && cEnd >= rowWidth) ||
+      (last > ZONE_END_COL(MAX_MODULES - 1)))
+    return(false);
+
+  _colStart = cStart;
+  _colEnd = cEnd;
+  _rowBase = rStart;
+  _zoneRows = rEnd - rStart + 1;
+  _rowWidth = rowWidth;
+  _rowFlip = rowFlip;
+  _colMask = (COL_BITS >= 32 ? 0xffffffff : ((colData_t)1 << COL_BITS) - 1);
+  _textShift = (COL_BITS - COL_SIZE) / 2;
+
+  _zoneStart = _zoneEnd = displayColumn(rStart, cStart) / COL_SIZE;
+  for (uint8_t r = rStart; r <= rEnd; r++)
+  {
+    uint16_t m1 = displayColumn(r, cStart) / COL_SIZE;
+    uint16_t m2 = displayColumn(r, cEnd) / COL_SIZE;
+
+    if (m1 > m2) { uint16_t t = m1; m1 = m2; m2 = t; }
+    if (m1 < _zoneStart) _zoneStart = m1;
+    if (m2 > _zoneEnd) _zoneEnd = m2;
+  }
+
+  allocateFrame();
+  _tCacheValid = false;
+
+  return(true);
+}
+
+bool MD_PZone::isDoubleHeight(void)
+// Double height text needs at least 2 module rows in the zone
+{
+  return(ZE_TEST(_zoneEffect, ZE_DOUBLE_MASK) && (_zoneRows >= 2));
+}
+
+uint16_t MD_PZone::displayColumn(uint8_t row, uint16_t c)
+// Module rows mounted rotated have the columns numbered in the opposite direction
+{
+  if (_rowFlip && (row & 1))
+    c = _rowWidth - 1 - c;
+
+  return(c + (row * _rowWidth));
+}
+#endif
+
+void MD_PZone::allocateFrame(void)
+// The text cache is allocated here as well. The displayed text never spans
+// more than the zone width, so it is not reallocated as messages change.
+// With ENA_RANDOM the frame is followed by the PA_RANDOM pixel mask.
+{
+  uint16_t size = _colEnd - _colStart + 1;
+
+  if (size != _frameSize)
+  {
+    if (_frame != nullptr) delete[] _frame;
+#if ENA_RANDOM
+    _frame = new colData_t[size + RAND_CYCLE];  // PA_RANDOM pixel mask follows the frame columns
+#else
+    _frame = new colData_t[size];
+#endif
+    _frameSize = (_frame == nullptr ? 0 : size);
+
+    if (_tCache != nullptr) delete[] _tCache;
+    _tCache = new colData_t[size];
+    _tCacheSize = (_tCache == nullptr ? 0 : size);
+    _tCacheValid = false;
+
+    if (_shadow != nullptr) delete[] _shadow;
+    _shadow = new colData_t[size];
+  }
+  _shadowValid = false;
+}
+
+void MD_PZone::clearFrame(void)
+{
+#if ENA_CANVAS
+  for (uint16_t i = 0; i < _frameSize; i++)
+    _frame[i] = EMPTY_BAR;
+#else
+  memset(_frame, EMPTY_BAR, _frameSize);
+#endif
+}
+
+void MD_PZone::shiftFrame(bool bLeft)
+// Column 0 of the frame is the rightmost column of the zone, so shifting
+// left moves the data to higher column numbers.
+{
+  if (_frameSize == 0)
+    return;
+
+  if (bLeft)
+  {
+    memmove(&_frame[1], &_frame[0], (_frameSize - 1) * sizeof(colData_t));
+    _frame[0] = 0;
+  }
+  else
+  {
+    memmove(&_frame[0], &_frame[1], (_frameSize - 1) * sizeof(colData_t));
+    _frame[_frameSize - 1] = 0;
+  }
+}
+
+void MD_PZone::shiftFrameBits(bool bUp, uint8_t n, int16_t cols)
+// Shift each frame column n LEDs up (towards bit 0) or down in a single
+// step, with blank LEDs shifted in, and move it cols columns across. Positive
+// cols moves to higher column numbers. Columns that nothing is moved into
+// are left unchanged.
+//
+// With byte columns, on processors with 32 bit or wider registers, the columns
+// are shifted a machine word at a time. Each byte of the word is shifted by the
+// same amount and the bits that cross into the next byte are masked off. Words
+// are loaded and stored with memcpy() so the frame need not be aligned. The
+// columns are processed from the end the data is moving towards, so the source
+// of each word has not been overwritten yet.
+{
+  colData_t fill = 0;
+  int16_t count = _frameSize - (cols >= 0 ? cols : -cols);  // columns moved
+  int16_t i;
+
+  if (count <= 0)
+    return;
+
+  if (_inverted && n != 0)
+    fill = (bUp ? COL_MASK & ~(COL_MASK >> n) : ((colData_t)1 << n) - 1);
+
+  colData_t *src = &_frame[cols >= 0 ? 0 : -cols];
+  colData_t *dst = &_frame[cols >= 0 ? cols : 0];
+
+#if !ENA_CANVAS
+  if (sizeof(size_t) >= 4 && n < COL_BITS)
+  {
+    const uint8_t W = sizeof(size_t);
+    const size_t ones = (size_t)-1 / 0xff;   // 0x01 in every byte
+    const size_t keep = ones * (bUp ? (uint8_t)(0xff >> n) : (uint8_t)(0xff << n));
+    const size_t fillW = ones * fill;
+    size_t w;
+
+    if (cols >= 0)
+    {
+      for (i = count - W; i >= 0; i -= W)
+      {
+        memcpy(&w, &src[i], W);
+        w = ((bUp ? w >> n : w << n) & keep) | fillW;
+        memcpy(&dst[i], &w, W);
+      }
+      for (i += W - 1; i >= 0; i--)
+        dst[i] = ((bUp ? src[i] >> n : src[i] << n) | fill) & COL_MASK;
+    }
+    else
+    {
+      for (i = 0; i + W <= count; i += W)
+      {
+        memcpy(&w, &src[i], W);
+        w = ((bUp ? w >> n : w << n) & keep) | fillW;
+        memcpy(&dst[i], &w, W);
+      }
+      for (; i < count; i++)
+        dst[i] = ((bUp ? src[i] >> n : src[i] << n) | fill) & COL_MASK;
+    }
+    return;
+  }
+#endif
+
+  if (cols >= 0)
+  {
+    for (i = count - 1; i >= 0; i--)
+      dst[i] = ((bUp ? src[i] >> n : src[i] << n) | fill) & COL_MASK;
+  }
+  else
+  {
+    for (i = 0; i < count; i++)
+      dst[i] = ((bUp ? src[i] >> n : src[i] << n) | fill) & COL_MASK;
+  }
+}
+
+#if ENA_CANVAS
+void MD_PZone::loadFrame(void)
+// Each module row of the zone is one byte of the frame columns, with the
+// top row of the zone in the least significant byte.
+{
+  memset(_frame, 0, _frameSize * sizeof(colData_t));
+
+  for (uint8_t b = 0; b < _zoneRows; b++)
+  {
+    uint8_t row = _rowBase + _zoneRows - 1 - b;
+    bool flip = _rowFlip && (row & 1);
+
+    for (uint16_t i = 0; i < _frameSize; i++)
+    {
+      uint8_t v = _MX->getColumn(displayColumn(row, _colStart + i));
+
+      if (flip) v = bitReverse(v);
+      _frame[i] |= (colData_t)v << (b * COL_SIZE);
+    }
+  }
+
+  // the display now matches the frame
+  if (_shadow != nullptr)
+  {
+    memcpy(_shadow, _frame, _frameSize * sizeof(colData_t));
+    _shadowValid = true;
+  }
+}
+
+void MD_PZone::flushFrame(void)
+// Only columns that differ from the last frame written are sent to the
+// display, so modules with no changes are not marked for update in the
+// MD_MAX72XX object. The modifier mask stage is applied on the way, LEDs
+// it hides show as blank.
+{
+  bool all = (_shadow == nullptr || !_shadowValid);
+
+  for (uint8_t b = 0; b < _zoneRows; b++)
+  {
+    uint8_t row = _rowBase + _zoneRows - 1 - b;
+    bool flip = _rowFlip && (row & 1);
+    uint8_t shift = b * COL_SIZE;
+    uint8_t keep = _stageMask >> shift;
+    uint8_t fill = (_inverted ? ~keep : 0);
+
+    for (uint16_t i = 0; i < _frameSize; i++)
+    {
+      uint8_t v = ((_frame[i] >> shift) & keep) | fill;
+
+      if (all || (uint8_t)(_shadow[i] >> shift) != v)
+      {
+        if (_shadow != nullptr)
+          _shadow[i] = (_shadow[i] & ~((colData_t)0xff << shift)) | ((colData_t)v << shift);
+        _MX->setColumn(displayColumn(row, _colStart + i), flip ? bitReverse(v) : v);
+      }
+    }
+  }
+  _shadowValid = (_shadow != nullptr);
+}
+
+void MD_PZone::zoneControl(MD_MAX72XX::controlRequest_t mode, int value)
+// Each module row of the zone is a separate range of modules
+{
+  for (uint8_t row = _rowBase; row < _rowBase + _zoneRows; row++)
+  {
+    uint16_t m1 = displayColumn(row, _colStart) / COL_SIZE;
+    uint16_t m2 = displayColumn(row, _colEnd) / COL_SIZE;
+
+    _MX->control(deviceNum(m1 < m2 ? m1 : m2), deviceNum(m1 < m2 ? m2 : m1), mode, value);
+  }
+}
+#else
+void MD_PZone::loadFrame(void)
+{
+  uint16_t c = _colStart;
+
+  for (uint16_t i = 0; i < _frameSize; i++)
+    _frame[i] = _MX->getColumn(c++);
+
+  // the display now matches the frame
+  if (_shadow != nullptr)
+  {
+    memcpy(_shadow, _frame, _frameSize * sizeof(colData_t));
+    _shadowValid = true;
+  }
 }
 
+void MD_PZone::flushFrame(void)
+// Only columns that differ from the last frame written are sent to the
+// display, so modules with no changes are not marked for update in the
+// MD_MAX72XX object. The modifier mask stage is applied on the way, LEDs
+// it hides show as blank.
+{
+  bool all = (_shadow == nullptr || !_shadowValid);
+  uint16_t c = _colStart;
+  uint8_t fill = (_inverted ? ~_stageMask : 0);
+
+  for (uint16_t i = 0; i < _frameSize; i++, c++)
+  {
+    uint8_t v = (_frame[i] & _stageMask) | fill;
+
+    if (all || _shadow[i] != v)
+    {
+      if (_shadow != nullptr) _shadow[i] = v;
+      _MX->setColumn(c, v);
+    }
+  }
+  _shadowValid = (_shadow != nullptr);
+}
+
+void MD_PZone::zoneControl(MD_MAX72XX::controlRequest_t mode, int value)
+{
+  _MX->control(deviceNum(_zoneStart), deviceNum(_zoneEnd), mode, value);
+}
+#endif
+
 void MD_PZone::allocateFontBuffer(void)
 {
   uint8_t size = _MX->getMaxFontWidth() + getCharSpacing();
@@ -68,8 +406,106 @@ void MD_PZone::allocateFontBuffer(void)
   {
     if (_cBuf != nullptr) delete[] _cBuf;
     _cBufSize = size;
-    _cBuf = new uint8_t[_cBufSize];
+    _cBuf = new colData_t[_cBufSize];
+#if ENA_CANVAS
+    if (_fBuf != nullptr) delete[] _fBuf;
+    _fBuf = new uint8_t[2 * _cBufSize];   // upper half of double height characters in the second half
+#endif
+  }
+}
+
+void MD_PZone::setTextBuffer(const char *pb)
+// With a text pool the text is copied into the pool and displayed from
+// there, otherwise the user buffer is displayed directly.
+{
+  if ((_textPool != nullptr) && (pb != nullptr))
+  {
+    if (pb != _textPool)
+    {
+      strncpy(_textPool, pb, _textPoolSize - 1);
+      _textPool[_textPoolSize - 1] = '\0';
+    }
+    pb = _textPool;
   }
+
+  _pText = (const uint8_t *)pb;
+  _cbText = nullptr;
+  _tCacheValid = false;
+}
+
+bool MD_PZone::appendText(const char *p)
+// Add text to the end of the message in the text pool. The text already
+// loaded by the animation is no longer needed and is discarded to make
+// room, so the pool only holds the text still to come. This only works if
+// the exit effect does not need the whole message again.
+{
+  uint16_t used, len, extra;
+
+  if ((_textPool == nullptr) || (p == nullptr) || (_cbText != nullptr) || isTextReversed() ||
+      (_effectIn != PA_SCROLL_LEFT) || ((_effectOut != PA_SCROLL_LEFT) && (_effectOut != PA_NO_EFFECT)))
+    return(false);
+
+  if (_pText != (const uint8_t *)_textPool)
+  {
+    if (_pText != nullptr)
+      return(false);    // the text is not in the pool
+    _textPool[0] = '\0';
+    _pText = (const uint8_t *)_textPool;
+    _fsmState = END;
+  }
+
+  len = strlen(_textPool);
+  extra = strlen(p);
+  if (_fsmState == END)
+    used = len;
+  else if (_fsmState == INITIALISE)
+    used = 0;
+  else
+    used = _pCurChar - _pText;
+
+  if (len - used + extra >= _textPoolSize)
+    return(false);
+
+  memmove(_textPool, _textPool + used, len - used);
+  memcpy(_textPool + len - used, p, extra + 1);
+  _pCurChar = _pText;
+  _tCacheValid = false;
+
+  if (_fsmState == END)
+  {
+    zoneReset();
+    return(true);
+  }
+
+  if (_fsmState == INITIALISE)
+    return(true);
+
+  // From now on the scroll stops when the last character is in, as the
+  // limits for the text alignment no longer apply.
+  _textLen = _colEnd - _colStart + 1;
+  _limitLeft = _colEnd;
+
+  if (!_endOfText)
+    return(true);
+
+  // The end of the text has been reached, so join the new text to the
+  // end of the scroll
+  _endOfText = false;
+  if (_moveIn && _fsmState == PUT_CHAR)
+  {
+    // the last character was loaded without the spacing after it
+    for (uint8_t i = 0; i < _charSpacing && _charCols < _cBufSize; i++)
+      _cBuf[_charCols++] = 0;
+  }
+  else
+  {
+    // back into the entry scroll, with the spacing for the last character
+    _moveIn = true;
+    _countCols = _charSpacing;
+    _fsmState = (_countCols == 0 ? GET_NEXT_CHAR : PUT_FILLER);
+  }
+
+  return(true);
 }
 
 void MD_PZone::setZoneEffect(boolean b, zoneEffect_t ze)
@@ -78,7 +514,9 @@ void MD_PZone::setZoneEffect(boolean b, zoneEffect_t ze)
   {
   case PA_FLIP_LR: _zoneEffect = (b ? ZE_SET(_zoneEffect, ZE_FLIP_LR_MASK) : ZE_RESET(_zoneEffect, ZE_FLIP_LR_MASK));  break;
   case PA_FLIP_UD: _zoneEffect = (b ? ZE_SET(_zoneEffect, ZE_FLIP_UD_MASK) : ZE_RESET(_zoneEffect, ZE_FLIP_UD_MASK));  break;
+  case PA_DOUBLE_HEIGHT: _zoneEffect = (b ? ZE_SET(_zoneEffect, ZE_DOUBLE_MASK) : ZE_RESET(_zoneEffect, ZE_DOUBLE_MASK));  break;
   }
+  _tCacheValid = false;
 
   return;
 }
@@ -89,6 +527,7 @@ boolean MD_PZone::getZoneEffect(zoneEffect_t ze)
   {
   case PA_FLIP_LR: return(ZE_TEST(_zoneEffect, ZE_FLIP_LR_MASK)); break;
   case PA_FLIP_UD: return(ZE_TEST(_zoneEffect, ZE_FLIP_UD_MASK)); break;
+  case PA_DOUBLE_HEIGHT: return(ZE_TEST(_zoneEffect, ZE_DOUBLE_MASK)); break;
   }
 
   return(false);
@@ -111,11 +550,26 @@ void MD_PZone::setInitialConditions(void)
 {
   PRINTS("\nsetInitialConditions");
 
+  if (_cbText != nullptr)
+  {
+    // Text from a source can only be pulled in as it scrolls left (see
+    // activeEffect()). The text width is unknown, so stop when the last
+    // character is in.
+    _pCurChar = nullptr;
+    _textLen = _colEnd - _colStart + 1;
+    _limitLeft = _colEnd;
+    _limitRight = _colStart;
+    _limitOverflow = true;
+    _tCacheValid = false;
+    return;
+  }
+
   if (_pText == nullptr)
     return;
 
   _pCurChar = _pText;
   _limitOverflow = !calcTextLimits(_pText);
+  _tCacheValid = false;
 }
 
 void MD_PZone::setInitialEffectConditions(void)
@@ -139,7 +593,12 @@ uint16_t MD_PZone::getTextWidth(const uint8_t *p)
 
   while (*p != '\0')
   {
-    width = findChar(*p++, _cBufSize, _cBuf);
+#if ENA_CANVAS
+    width = findChar(charCode(p), _cBufSize, _fBuf);
+#else
+    width = findChar(charCode(p), _cBufSize, _cBuf);
+#endif
+    p = nextChar(p);
     sum += width;
     if (width != 0 && *p) sum += _charSpacing;  // this char had width, so add inter-character spacing
   }
@@ -155,7 +614,7 @@ bool MD_PZone::calcTextLimits(const uint8_t *p)
 // in the current display the return false, otherwise true.
 {
   bool b = true;
-  uint16_t displayWidth = ZONE_END_COL(_zoneEnd) - ZONE_START_COL(_zoneStart) + 1;
+  uint16_t displayWidth = _colEnd - _colStart + 1;
 
   _textLen = getTextWidth(p);
 
@@ -165,10 +624,10 @@ bool MD_PZone::calcTextLimits(const uint8_t *p)
   switch (_textAlignment)
   {
   case PA_LEFT:
-    _limitLeft = ZONE_END_COL(_zoneEnd);
+    _limitLeft = _colEnd;
     if (_textLen > displayWidth)
     {
-      _limitRight = ZONE_START_COL(_zoneStart);
+      _limitRight = _colStart;
       b = false;
      }
     else
@@ -178,10 +637,10 @@ bool MD_PZone::calcTextLimits(const uint8_t *p)
     break;
 
   case PA_RIGHT:
-    _limitRight = ZONE_START_COL(_zoneStart);
+    _limitRight = _colStart;
     if (_textLen > displayWidth)
     {
-      _limitLeft = ZONE_END_COL(_zoneEnd);
+      _limitLeft = _colEnd;
       b = false;
     }
     else
@@ -193,13 +652,13 @@ bool MD_PZone::calcTextLimits(const uint8_t *p)
   case PA_CENTER:
     if (_textLen > displayWidth)
     {
-      _limitLeft = ZONE_END_COL(_zoneEnd);
-      _limitRight = ZONE_START_COL(_zoneStart);
+      _limitLeft = _colEnd;
+      _limitRight = _colStart;
       b = false;
     }
     else
     {
-      _limitRight = ZONE_START_COL(_zoneStart) + ((displayWidth - _textLen) / 2);
+      _limitRight = _colStart + ((displayWidth - _textLen) / 2);
       _limitLeft = _limitRight + _textLen - 1;
     }
     break;
@@ -212,102 +671,116 @@ bool MD_PZone::calcTextLimits(const uint8_t *p)
   return (b);
 }
 
+uint16_t MD_PZone::findUserChar(uint16_t code)
+// Binary search the sorted user character table. Returns the index of the
+// entry with the code if it exists, otherwise the index where it should
+// be inserted to keep the table sorted.
+{
+  uint16_t lo = 0, hi = _userCharCount;
+
+  while (lo < hi)
+  {
+    uint16_t mid = lo + (hi - lo) / 2;
+
+    if (_userChars[mid].code < code)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+
+  return(lo);
+}
+
 bool MD_PZone::addChar(uint16_t code, uint8_t *data)
-// Add a user defined character to the replacement list
+// Add a user defined character to the replacement table
 {
-  charDef_t *pcd;
+  const uint8_t TABLE_BLOCK = 8;  // table grows by this many entries at a time
+  uint16_t idx;
 
   if (code == 0)
     return(false);
 
   PRINTX("\naddChar 0x", code);
+  _tCacheValid = false;
 
-  // first see if we have the code in our list
-  pcd = _userChars;
-  while (pcd != nullptr)
+  // first see if we have the code in our table
+  idx = findUserChar(code);
+  if (idx < _userCharCount && _userChars[idx].code == code)
   {
-    if (pcd->code == code)
-    {
-      pcd->data = data;
-      PRINTS(" found existing in list");
-      return(true);
-    }
-    pcd = pcd->next;
+    _userChars[idx].data = data;
+    PRINTS(" found existing in table");
+    return(true);
   }
 
-  // Now see if we have an empty slot in our list
-  pcd = _userChars;
-  while (pcd != nullptr)
+  // make sure there is room in the table for another entry
+  if (_userCharCount == _userCharSize)
   {
-    if (pcd->code == 0)
+    charDef_t *p = new charDef_t[_userCharSize + TABLE_BLOCK];
+
+    if (p == nullptr)
     {
-      pcd->code = code;
-      pcd->data = data;
-      PRINTS(" found empty slot");
-      return(true);
+      PRINTS(" failed allocating table");
+      return(false);
     }
-    pcd = pcd->next;
-  }
 
-  // default is to add a new node to the front of the list
-  if ((pcd = new charDef_t) != nullptr)
-  {
-    pcd->code = code;
-    pcd->data = data;
-    pcd->next = _userChars;
-    _userChars = pcd;
-    PRINTS(" added new node");
-  }
-  else
-  {
-    PRINTS(" failed allocating new node");
+    if (_userChars != nullptr)
+    {
+      memcpy(p, _userChars, _userCharCount * sizeof(charDef_t));
+      delete[] _userChars;
+    }
+    _userChars = p;
+    _userCharSize += TABLE_BLOCK;
   }
 
-  return(pcd != nullptr);
+  // open a gap at the insertion point to keep the table sorted
+  memmove(&_userChars[idx + 1], &_userChars[idx], (_userCharCount - idx) * sizeof(charDef_t));
+  _userChars[idx].code = code;
+  _userChars[idx].data = data;
+  _userCharCount++;
+  PRINTS(" added new entry");
+
+  return(true);
 }
 
 bool MD_PZone::delChar(uint16_t code)
-// Delete a user defined character from the replacement list
+// Delete a user defined character from the replacement table
 {
-  charDef_t *pcd = _userChars;
+  uint16_t idx;
 
   if (code == 0)
     return(false);
 
-  // Scan down the linked list
-  while (pcd != nullptr)
-  {
-    if (pcd->code == code)
-    {
-      pcd->code = 0;
-      pcd->data = nullptr;
-      break;
-    }
-    pcd = pcd->next;
-  }
+  _tCacheValid = false;
+
+  idx = findUserChar(code);
+  if (idx >= _userCharCount || _userChars[idx].code != code)
+    return(false);
 
-  return(pcd != nullptr);
+  // close the gap so that the table stays compact
+  _userCharCount--;
+  memmove(&_userChars[idx], &_userChars[idx + 1], (_userCharCount - idx) * sizeof(charDef_t));
+
+  return(true);
 }
 
 uint8_t MD_PZone::findChar(uint16_t code, uint8_t size, uint8_t *cBuf)
-// Find a character either in user defined list or from font table
+// Find a character either in user defined table or from font table
 {
-  charDef_t *pcd = _userChars;
   uint8_t len;
 
   PRINTX("\nfindUserChar 0x", code);
-  // check local list first
-  while (pcd != nullptr)
+  // check local table first
+  if (_userCharCount != 0)
   {
-    PRINTX(" ", pcd->code);
-    if (pcd->code == code)  // found it
+    uint16_t idx = findUserChar(code);
+
+    if (idx < _userCharCount && _userChars[idx].code == code)  // found it
     {
       PRINTS(" found character");
-      len = min(size, pcd->data[0]);
-      memcpy(cBuf, &pcd->data[1], len);
+      len = min(size, _userChars[idx].data[0]);
+      memcpy(cBuf, &_userChars[idx].data[1], len);
       return(len);
     }
-    pcd = pcd->next;
   }
 
   // get it from the standard font
@@ -324,7 +797,31 @@ uint8_t MD_PZone::makeChar(uint16_t c, bool addBlank)
   uint8_t len;
 
   // look for the character
+#if ENA_CANVAS
+  len = findChar(c, _cBufSize, _fBuf);
+  if (isDoubleHeight())
+  {
+    // The font has the lower half of the character at the character code
+    // and the upper half at the code with the high bit set. Both halves
+    // are placed in the zone column together, centered vertically.
+    uint8_t *pUpper = _fBuf + _cBufSize;
+    uint8_t lenUpper = findChar(c | 0x80, _cBufSize, pUpper);
+
+    for (uint8_t i = 0; i < len; i++)
+    {
+      colData_t col = (i < lenUpper ? pUpper[i] : 0) | ((colData_t)_fBuf[i] << COL_SIZE);
+
+      _cBuf[i] = col << ((COL_BITS - (2 * COL_SIZE)) / 2);
+    }
+  }
+  else
+  {
+    for (uint8_t i = 0; i < len; i++)
+      _cBuf[i] = TEXT_COL(_fBuf[i]);
+  }
+#else
   len = findChar(c, _cBufSize, _cBuf);
+#endif
 
   PRINTX("\nmakeChar 0x", c);
   PRINT(", len=", len);
@@ -342,36 +839,65 @@ uint8_t MD_PZone::makeChar(uint16_t c, bool addBlank)
   return(len);
 }
 
-void MD_PZone::reverseBuf(uint8_t *p, uint8_t size)
-// reverse the elements of the specified buffer
-// useful when we are scrolling right and want to insert the columns in reverse order
+// bit reversed value of each nibble, used to reverse a byte in two lookups
+static const uint8_t PROGMEM nibbleReverse[16] =
 {
-  for (uint8_t i = 0; i < size / 2; i++)
-  {
-    uint8_t t;
+  0x0, 0x8, 0x4, 0xc, 0x2, 0xa, 0x6, 0xe, 0x1, 0x9, 0x5, 0xd, 0x3, 0xb, 0x7, 0xf
+};
 
-    t = p[i];
-    p[i] = p[size - 1 - i];
-    p[size - 1 - i] = t;
-  }
+uint8_t MD_PZone::bitReverse(uint8_t v)
+// reverse the order of the bits in a byte
+{
+  return((pgm_read_byte(&nibbleReverse[v & 0xf]) << 4) | pgm_read_byte(&nibbleReverse[v >> 4]));
 }
 
-void MD_PZone::invertBuf(uint8_t *p, uint8_t size)
-// invert the elements of the specified buffer
-// used when the character needs to be inverted when ZE_FLIP_UD
+colData_t MD_PZone::invertCol(colData_t c)
+// invert a column top to bottom
 {
-  for (uint8_t i = 0; i < size; i++)
-  {
-    uint8_t v = p[i];
+#if ENA_CANVAS
+  // reverse each byte and the order of the bytes in the zone column
+  colData_t v = 0;
+
+  for (uint8_t b = 0; b < _zoneRows; b++)
+    v = (v << COL_SIZE) | bitReverse(c >> (b * COL_SIZE));
 
-    v = ((v >> 1) & 0x55) | ((v & 0x55) << 1);  // swap odd and even bits
-    v = ((v >> 2) & 0x33) | ((v & 0x33) << 2);  // swap consecutive pairs
-    v = ((v >> 4) & 0x0F) | ((v & 0x0F) << 4);  // swap nibbles ...
+  return(v);
+#else
+  return(bitReverse(c));
+#endif
+}
 
-    p[i] = v;
+void MD_PZone::flipBuf(colData_t *p, uint8_t size, bool bReverse, bool bInvert)
+// Reverse the order of the elements of the buffer and/or invert each element
+// in a single pass. Reversing is needed when we are scrolling right and want
+// to insert the columns in reverse order, inverting when ZE_FLIP_UD is set.
+{
+  if (bReverse)
+  {
+    for (uint8_t i = 0; i < size / 2; i++)
+    {
+      colData_t t = p[i];
+
+      p[i] = (bInvert ? invertCol(p[size - 1 - i]) : p[size - 1 - i]);
+      p[size - 1 - i] = (bInvert ? invertCol(t) : t);
+    }
+    if (bInvert && (size & 1))    // odd size, the middle element stays in place
+      p[size / 2] = invertCol(p[size / 2]);
+  }
+  else if (bInvert)
+  {
+    for (uint8_t i = 0; i < size; i++)
+      p[i] = invertCol(p[i]);
   }
 }
 
+bool MD_PZone::isTextReversed(void)
+// The text is processed from the end of the string when scrolling right
+// or when the zone is flipped left to right, but not both.
+{
+  return(ZE_TEST(_zoneEffect, ZE_FLIP_LR_MASK) != SFX(PA_SCROLL_RIGHT));
+}
+
 void MD_PZone::moveTextPointer(void)
 // This method works when increment is done AFTER processing the character
 // The _endOfText flag is set as a look ahead (ie, when the last character
@@ -381,23 +907,70 @@ void MD_PZone::moveTextPointer(void)
 {
   PRINTS("\nMovePtr");
 
-  if ((!ZE_TEST(_zoneEffect, ZE_FLIP_LR_MASK) && SFX(PA_SCROLL_RIGHT)) ||
-    (ZE_TEST(_zoneEffect, ZE_FLIP_LR_MASK) && !SFX(PA_SCROLL_RIGHT)))
+  if (isTextReversed())
   {
     PRINTS(" --");
     _endOfText = (_pCurChar == _pText);
-    _pCurChar--;
+    if (!_endOfText)
+      _pCurChar = prevChar(_pCurChar);
   }
   else
   {
     PRINTS(" ++");
-    _pCurChar++;
+    _pCurChar = nextChar(_pCurChar);
     _endOfText = (*_pCurChar == '\0');
   }
 
   PRINT(": endOfText ", _endOfText);
 }
 
+uint16_t MD_PZone::charCode(const uint8_t *p)
+// The character code for the text at p. When decoding UTF-8, a multi-byte
+// sequence is converted to its Unicode code point.
+{
+  uint32_t code;
+  uint8_t  n;   // number of continuation bytes
+
+  if (!_utf8 || *p < 0x80)
+    return(*p);
+
+  if ((*p & 0xe0) == 0xc0)      { code = *p & 0x1f; n = 1; }
+  else if ((*p & 0xf0) == 0xe0) { code = *p & 0x0f; n = 2; }
+  else if ((*p & 0xf8) == 0xf0) { code = *p & 0x07; n = 3; }
+  else return(UTF8_INVALID);    // continuation byte without a lead byte
+
+  while (n--)
+  {
+    p++;
+    if ((*p & 0xc0) != 0x80)    // sequence cut short, also stops at the nul
+      return(UTF8_INVALID);
+    code = (code << 6) | (*p & 0x3f);
+  }
+
+  return(code > 0xffff ? UTF8_INVALID : code);
+}
+
+const uint8_t *MD_PZone::nextChar(const uint8_t *p)
+// Step over the character at p, including any UTF-8 continuation bytes
+{
+  p++;
+  if (_utf8)
+    while ((*p & 0xc0) == 0x80) p++;
+
+  return(p);
+}
+
+const uint8_t *MD_PZone::prevChar(const uint8_t *p)
+// Step back to the start of the character before p, skipping back
+// over any UTF-8 continuation bytes to the lead byte
+{
+  p--;
+  if (_utf8)
+    while ((p > _pText) && ((*p & 0xc0) == 0x80)) p--;
+
+  return(p);
+}
+
 bool MD_PZone::getFirstChar(uint8_t &len)
 // load the first char into the char buffer, set len to the number of columns
 // return false if there are no characters
@@ -408,6 +981,23 @@ bool MD_PZone::getFirstChar(uint8_t &len)
   PRINT(" ZETEST(UD):", ZE_TEST(_zoneEffect, ZE_FLIP_UD_MASK));
   PRINT(" ZETEST(LR):", ZE_TEST(_zoneEffect, ZE_FLIP_LR_MASK));
 
+  // text from a source is read one character ahead to know when it ends
+  if (_cbText != nullptr)
+  {
+    uint16_t code = _cbText();
+
+    _endOfText = true;
+    if (code == 0)
+      return(false);
+
+    _nextCode = _cbText();
+    _endOfText = (_nextCode == 0);
+    len = makeChar(code, !_endOfText);
+    flipBuf(_cBuf, len, false, ZE_TEST(_zoneEffect, ZE_FLIP_UD_MASK));
+
+    return(true);
+  }
+
   // initialise pointers and make sure we have a good string to process
   _pCurChar = _pText;
   if ((_pCurChar == nullptr) || (*_pCurChar == '\0'))
@@ -416,28 +1006,16 @@ bool MD_PZone::getFirstChar(uint8_t &len)
     return(false);
   }
   _endOfText = false;
-  if ((!ZE_TEST(_zoneEffect, ZE_FLIP_LR_MASK) && (SFX(PA_SCROLL_RIGHT))) ||
-    (ZE_TEST(_zoneEffect, ZE_FLIP_LR_MASK) && !SFX(PA_SCROLL_RIGHT)))
+  if (isTextReversed())
   {
     PRINTS("\nReversed String");
-    _pCurChar += strlen((const char *)_pText) - 1;
+    _pCurChar = prevChar(_pText + strlen((const char *)_pText));
   }
 
   // good string, get the first char into the current buffer
-  len = makeChar(*_pCurChar, *(_pCurChar + 1) != '\0');
+  len = makeChar(charCode(_pCurChar), *nextChar(_pCurChar) != '\0');
 
-  if ((!ZE_TEST(_zoneEffect, ZE_FLIP_LR_MASK) && (SFX(PA_SCROLL_RIGHT))) ||
-    (ZE_TEST(_zoneEffect, ZE_FLIP_LR_MASK) && !SFX(PA_SCROLL_RIGHT)))
-  {
-    PRINTS("\nReverse Buffer");
-    reverseBuf(_cBuf, len);
-  }
-
-  if ZE_TEST(_zoneEffect, ZE_FLIP_UD_MASK)
-  {
-    PRINTS("\nInvert buffer");
-    invertBuf(_cBuf, len);
-  }
+  flipBuf(_cBuf, len, isTextReversed(), ZE_TEST(_zoneEffect, ZE_FLIP_UD_MASK));
 
   moveTextPointer();
 
@@ -457,136 +1035,473 @@ bool MD_PZone::getNextChar(uint8_t &len)
   if (_endOfText)
     return(false);
 
-  len = makeChar(*_pCurChar, *(_pCurChar + 1) != '\0');
-
-  if ((!ZE_TEST(_zoneEffect, ZE_FLIP_LR_MASK) && (SFX(PA_SCROLL_RIGHT))) ||
-    (ZE_TEST(_zoneEffect, ZE_FLIP_LR_MASK) && !SFX(PA_SCROLL_RIGHT)))
+  if (_cbText != nullptr)
   {
-    PRINTS("\nReversed Buffer");
-    reverseBuf(_cBuf, len);
-  }
+    uint16_t code = _nextCode;
 
-  if ZE_TEST(_zoneEffect, ZE_FLIP_UD_MASK)
-  {
-    PRINTS("\nInvert Buffer");
-    invertBuf(_cBuf, len);
+    _nextCode = _cbText();
+    _endOfText = (_nextCode == 0);
+    len = makeChar(code, !_endOfText);
+    flipBuf(_cBuf, len, false, ZE_TEST(_zoneEffect, ZE_FLIP_UD_MASK));
+
+    return(true);
   }
 
+  len = makeChar(charCode(_pCurChar), *nextChar(_pCurChar) != '\0');
+
+  flipBuf(_cBuf, len, isTextReversed(), ZE_TEST(_zoneEffect, ZE_FLIP_UD_MASK));
+
   moveTextPointer();
 
   return(true);
 }
 
-bool MD_PZone::zoneAnimate(void)
+void MD_PZone::cacheText(void)
+// Render the text columns that commonPrint() places between _limitLeft
+// and _limitRight into the text cache. The cache is reused for every
+// frame until it is invalidated by a change of text or attributes, or by
+// a reset. It is left invalid if the text cannot be cached, and then
+// commonPrint() renders the text itself.
 {
-#if TIME_PROFILING
-  static uint32_t  cycleStartTime;
-#endif
-  _animationAdvanced = false;   // assume this will not happen this time around
+  uint16_t size = _limitLeft - _limitRight + 1;
 
-  if (_fsmState == END)
-    return(true);
+  PRINT("\ncacheText: size=", size);
 
-  // work through things that stop us running this at all
-  uint32_t tickTime = (_moveIn ? _tickTimeIn : _tickTimeOut);
-  if (((_fsmState == PAUSE) && (millis() - _lastRunTime < _pauseTime)) ||
-    (millis() - _lastRunTime < tickTime) ||
-    (_suspend))
-    return(false);
+  // text from a source cannot be read a second time
+  if ((_tCache == nullptr) || (size > _tCacheSize) || (_cbText != nullptr))
+    return;
 
-  // save the time now, before we run the animation, so that the animation is part of the
-  // delay between animations giving more accurate frame timing.
-  _lastRunTime = millis();
-  _animationAdvanced = true;    // we now know it will happen!
+  getFirstChar(_charCols);
+  _countCols = 0;
 
-  // any text to display?
-  if (_pText != nullptr)
+  for (uint16_t i = 0; i < size; )
   {
-    switch (_fsmState)
+    if (_countCols == _charCols || _charCols == 0)
     {
-      case END:   // do nothing in this state
-        PRINT_STATE("ANIMATE");
+      if (!getNextChar(_charCols))
+      {
+        // ran out of text, pad the rest of the cache with blank columns
+        memset(&_tCache[i], 0, (size - i) * sizeof(colData_t));
         break;
+      }
+      _countCols = 0;
+    }
+
+    if (_charCols != 0)
+      _tCache[i++] = _cBuf[_countCols++];
+  }
+
+  _tCacheReversed = isTextReversed();
+  _tCacheValid = true;
+}
+
+uint32_t MD_PZone::getFrameDelay(void)
+// The time between frames is the tick for the current motion,
+// extended to the pause time when pausing
+{
+  uint32_t delay = (_moveIn ? _tickTimeIn : _tickTimeOut);
 
-      case INITIALISE:
-        PRINT_STATE("ANIMATE");
-#if TIME_PROFILING
-        cycleStartTime = millis();
+  if ((_fsmState == PAUSE) && !_modHold && (_pauseTime > delay))
+    delay = _pauseTime;
+
+  return(delay);
+}
+
+uint32_t MD_PZone::getWaitTime(uint32_t now)
+// Work through things that stop us running the animation at all
+// and how long before we next can
+{
+  if (_suspend)
+    return(WAIT_FOREVER);
+
+  if (_fsmState == END)
+  {
+#if ENA_QUEUE
+    // the next queued message starts straight away
+    if (_qCount != 0)
+      return(0);
 #endif
-        setInitialConditions();
-        _moveIn = true;
-        // fall through to process the effect, first call will be with INITIALISE
-
-      default: // All state except END are handled by the special effect functions
-        PRINT_STATE("ANIMATE");
-        switch (_moveIn ? _effectIn : _effectOut)
-        {
-        case PA_PRINT:        effectPrint(_moveIn);           break;
-        case PA_SCROLL_UP:    effectVScroll(true, _moveIn);   break;
-        case PA_SCROLL_DOWN:  effectVScroll(false, _moveIn);  break;
-        case PA_SCROLL_LEFT:  effectHScroll(true, _moveIn);   break;
-        case PA_SCROLL_RIGHT: effectHScroll(false, _moveIn);  break;
+    return(WAIT_FOREVER);
+  }
+
+  uint32_t delay = getFrameDelay();
+  uint32_t elapsed = now - _lastRunTime;
+
+  return(elapsed >= delay ? 0 : delay - elapsed);
+}
+
+bool MD_PZone::isAnimationDue(uint32_t now)
+{
+  return(getWaitTime(now) == 0);
+}
+
+// Effect table entries, one for each effect and its method options
+void MD_PZone::fnPrint(MD_PZone *z, bool bIn) { z->effectPrint(bIn); }
+void MD_PZone::fnScrollUp(MD_PZone *z, bool bIn) { z->effectVScroll(true, bIn); }
+void MD_PZone::fnScrollDown(MD_PZone *z, bool bIn) { z->effectVScroll(false, bIn); }
+void MD_PZone::fnScrollLeft(MD_PZone *z, bool bIn) { z->effectHScroll(true, bIn); }
+void MD_PZone::fnScrollRight(MD_PZone *z, bool bIn) { z->effectHScroll(false, bIn); }
+#if ENA_SPRITE
+void MD_PZone::fnSprite(MD_PZone *z, bool bIn) { z->effectSprite(bIn, PA_SPRITE); }
+#endif // ENA_SPRITE
 #if ENA_MISC
-        case PA_SLICE:    effectSlice(_moveIn);     break;
-        case PA_MESH:     effectMesh(_moveIn);      break;
-        case PA_FADE:     effectFade(_moveIn);      break;
-        case PA_BLINDS:   effectBlinds(_moveIn);    break;
-        case PA_DISSOLVE: effectDissolve(_moveIn);  break;
-        case PA_RANDOM:   effectRandom(_moveIn);    break;
+void MD_PZone::fnSlice(MD_PZone *z, bool bIn) { z->effectSlice(bIn); }
+void MD_PZone::fnMesh(MD_PZone *z, bool bIn) { z->effectMesh(bIn); }
+void MD_PZone::fnFade(MD_PZone *z, bool bIn) { z->effectFade(bIn); }
+void MD_PZone::fnDissolve(MD_PZone *z, bool bIn) { z->effectDissolve(bIn); }
+void MD_PZone::fnBlinds(MD_PZone *z, bool bIn) { z->effectBlinds(bIn); }
 #endif // ENA_MISC
+#if ENA_RANDOM
+void MD_PZone::fnRandom(MD_PZone *z, bool bIn) { z->effectRandom(bIn); }
+#endif // ENA_RANDOM
+#if ENA_WIPE
+void MD_PZone::fnWipe(MD_PZone *z, bool bIn) { z->effectWipe(false, bIn); }
+void MD_PZone::fnWipeCursor(MD_PZone *z, bool bIn) { z->effectWipe(true, bIn); }
+#endif // ENA_WIPE
+#if ENA_SCAN
+void MD_PZone::fnScanHoriz(MD_PZone *z, bool bIn) { z->effectHScan(bIn, false); }
+void MD_PZone::fnScanHorizX(MD_PZone *z, bool bIn) { z->effectHScan(bIn, true); }
+void MD_PZone::fnScanVert(MD_PZone *z, bool bIn) { z->effectVScan(bIn, false); }
+void MD_PZone::fnScanVertX(MD_PZone *z, bool bIn) { z->effectVScan(bIn, true); }
+#endif // ENA_SCAN
+#if ENA_OPNCLS
+void MD_PZone::fnOpening(MD_PZone *z, bool bIn) { z->effectOpen(false, bIn); }
+void MD_PZone::fnOpeningCursor(MD_PZone *z, bool bIn) { z->effectOpen(true, bIn); }
+void MD_PZone::fnClosing(MD_PZone *z, bool bIn) { z->effectClose(false, bIn); }
+void MD_PZone::fnClosingCursor(MD_PZone *z, bool bIn) { z->effectClose(true, bIn); }
+#endif // ENA_OPNCLS
+#if ENA_SCR_DIA
+void MD_PZone::fnScrollUpLeft(MD_PZone *z, bool bIn) { z->effectDiag(true, true, bIn); }
+void MD_PZone::fnScrollUpRight(MD_PZone *z, bool bIn) { z->effectDiag(true, false, bIn); }
+void MD_PZone::fnScrollDownLeft(MD_PZone *z, bool bIn) { z->effectDiag(false, true, bIn); }
+void MD_PZone::fnScrollDownRight(MD_PZone *z, bool bIn) { z->effectDiag(false, false, bIn); }
+#endif // ENA_SCR_DIA
+#if ENA_GROW
+void MD_PZone::fnGrowUp(MD_PZone *z, bool bIn) { z->effectGrow(true, bIn); }
+void MD_PZone::fnGrowDown(MD_PZone *z, bool bIn) { z->effectGrow(false, bIn); }
+#endif // ENA_GROW
+
+// The entries must be in the same order as textEffect_t and use the same ENA_*
+// switches, so that the effect value is the index into the table. PA_CUSTOM
+// has a fixed value outside the table and is dispatched separately. The
+// table size is checked against LAST_EFFECT in animateFrame().
+const MD_PZone::effectFn_t MD_PZone::_effectTable[] PROGMEM =
+{
+  nullptr,    // PA_NO_EFFECT
+  fnPrint,
+  fnScrollUp,
+  fnScrollDown,
+  fnScrollLeft,
+  fnScrollRight,
 #if ENA_SPRITE
-        case PA_SPRITE:
-          effectSprite(_moveIn, _moveIn ? _effectIn : _effectOut);  break;
+  fnSprite,
 #endif // ENA_SPRITE
+#if ENA_MISC
+  fnSlice,
+  fnMesh,
+  fnFade,
+  fnDissolve,
+  fnBlinds,
+#endif // ENA_MISC
+#if ENA_RANDOM
+  fnRandom,
+#endif // ENA_RANDOM
 #if ENA_WIPE
-        case PA_WIPE:         effectWipe(false, _moveIn); break;
-        case PA_WIPE_CURSOR:  effectWipe(true, _moveIn);  break;
+  fnWipe,
+  fnWipeCursor,
 #endif // ENA_WIPE
 #if ENA_SCAN
-        case PA_SCAN_HORIZX: effectHScan(_moveIn, true); break;
-        case PA_SCAN_HORIZ:  effectHScan(_moveIn, false); break;
-        case PA_SCAN_VERTX:  effectVScan(_moveIn, true); break;
-        case PA_SCAN_VERT:   effectVScan(_moveIn, false); break;
+  fnScanHoriz,
+  fnScanHorizX,
+  fnScanVert,
+  fnScanVertX,
 #endif // ENA_SCAN
 #if ENA_OPNCLS
-        case PA_OPENING:        effectOpen(false, _moveIn); break;
-        case PA_OPENING_CURSOR: effectOpen(true, _moveIn);  break;
-        case PA_CLOSING:        effectClose(false, _moveIn); break;
-        case PA_CLOSING_CURSOR: effectClose(true, _moveIn); break;
+  fnOpening,
+  fnOpeningCursor,
+  fnClosing,
+  fnClosingCursor,
 #endif // ENA_OPNCLS
 #if ENA_SCR_DIA
-        case PA_SCROLL_UP_LEFT:     effectDiag(true, true, _moveIn);  break;
-        case PA_SCROLL_UP_RIGHT:    effectDiag(true, false, _moveIn); break;
-        case PA_SCROLL_DOWN_LEFT:   effectDiag(false, true, _moveIn); break;
-        case PA_SCROLL_DOWN_RIGHT:  effectDiag(false, false, _moveIn); break;
+  fnScrollUpLeft,
+  fnScrollUpRight,
+  fnScrollDownLeft,
+  fnScrollDownRight,
 #endif // ENA_SCR_DIA
 #if ENA_GROW
-        case PA_GROW_UP:     effectGrow(true, _moveIn);  break;
-        case PA_GROW_DOWN:   effectGrow(false, _moveIn); break;
+  fnGrowUp,
+  fnGrowDown,
 #endif // ENA_GROW
-        default:
+};
+
+void MD_PZone::animateFrame(void)
+// Run the FSM for the current effect to build the next frame
+{
+  switch (_fsmState)
+  {
+    case END:   // do nothing in this state
+      PRINT_STATE("ANIMATE");
+      break;
+
+    case INITIALISE:
+      PRINT_STATE("ANIMATE");
+      setInitialConditions();
+      loadFrame();
+      _moveIn = true;
+      _modIn = true;
+      _modStep = 0;
+      _modHold = false;
+      // fall through to process the effect, first call will be with INITIALISE
+
+    default: // All state except END are handled by the special effect functions
+      PRINT_STATE("ANIMATE");
+      if (!_modHold)
+      {
+        static_assert(ARRAY_SIZE(_effectTable) == LAST_EFFECT + 1, "_effectTable[] needs one entry for each textEffect_t value up to LAST_EFFECT");
+        static_assert(LAST_EFFECT < PA_CUSTOM, "PA_CUSTOM must follow the table effects");
+
+        uint8_t e = activeEffect();
+        effectFn_t fn = (e < ARRAY_SIZE(_effectTable) ? (effectFn_t)pgm_read_ptr(&_effectTable[e]) : nullptr);
+
+        if (e == PA_CUSTOM)
+          effectCustom(_moveIn);
+        else if (fn != nullptr)
+          fn(this, _moveIn);
+        else
           _fsmState = END;
       }
 
-      // one way toggle for input to output, reset on initialize
-      _moveIn = _moveIn && !(_fsmState == PAUSE);
-      break;
+      // The entry effect is not finished until the modifier has finished.
+      // Until then the zone stays in PAUSE running frames at the entry speed.
+      {
+        bool bDone = modifierStage();
+
+        _modHold = (_moveIn && (_fsmState == PAUSE) && !bDone);
+      }
+
+    // one way toggle for input to output, reset on initialize
+    _moveIn = _moveIn && !((_fsmState == PAUSE) && !_modHold);
+    break;
+  }
+}
+
+bool MD_PZone::modifierStage(void)
+// Work out the mask and intensity stages of the modifier for this frame.
+// The entry stages build up the display from nothing and the exit stages
+// take it down again. When the exit effect has ended, or there is no
+// modifier, the stages go back to showing the frame as it is.
+{
+  bool bDone = true;
+
+  // start again for the exit effect
+  if (_modIn != _moveIn)
+  {
+    _modIn = _moveIn;
+    _modStep = 0;
+  }
+
+  _stageMask = ~(colData_t)0;
+
+  // put back the intensity if the intensity stage is no longer running
+#if ENA_MISC
+  if ((_stageIntensity != 0xff) && ((_fsmState == END) || (_modEffect != PA_FADE)))
+#else
+  if (_stageIntensity != 0xff)
+#endif
+  {
+    zoneControl(MD_MAX72XX::INTENSITY, _intensity);
+    _stageIntensity = 0xff;
+  }
+
+  switch (_fsmState == END ? PA_NO_EFFECT : _modEffect)
+  {
+#if ENA_GROW
+  case PA_GROW_UP:    // rows are shown from the bottom up
+  case PA_GROW_DOWN:  // rows are shown from the top down
+    {
+      int16_t rows = (_moveIn ? _modStep + 1 : COL_BITS - 1 - _modStep);
+
+      if (rows <= 0)
+        _stageMask = 0;
+      else if (rows < COL_BITS)
+        _stageMask = (_modEffect == PA_GROW_UP ? ~(COL_MASK >> rows) : COL_MASK >> (COL_BITS - rows));
+
+      bDone = (_moveIn ? rows >= COL_BITS : rows <= 0);
+    }
+    break;
+#endif // ENA_GROW
+
+#if ENA_MISC
+  case PA_FADE:       // intensity ramps up from nothing to the zone intensity
+    {
+      int16_t level = (_moveIn ? _modStep - 1 : _intensity - _modStep);
+
+      if (level < 0)
+        _stageMask = 0;
+      else if (level > _intensity)
+        level = _intensity;
+
+      if (level >= 0 && level != _stageIntensity)
+      {
+        zoneControl(MD_MAX72XX::INTENSITY, level);
+        _stageIntensity = level;
+      }
+
+      bDone = (_moveIn ? level == _intensity : level < 0);
     }
+    break;
+#endif // ENA_MISC
+
+  default:
+    break;
   }
 
-#if  TIME_PROFILING
-  Serial.print("\nAnim time: ");
-  Serial.print(millis() - _lastRunTime);
+  if (!bDone) _modStep++;
+
+  return(bDone);
+}
+
+bool MD_PZone::zoneAnimate(uint32_t now)
+{
+#if ENA_STATS
+  uint32_t frameStart;
+#endif
+  _animationAdvanced = false;   // assume this will not happen this time around
+
+#if ENA_QUEUE
+  // start the next queued message once the current one has ended
+  if ((_fsmState == END) && (_qCount != 0) && !_suspend)
+    queueNext();
+#endif
+
   if (_fsmState == END)
+    return(true);
+
+  if (!isAnimationDue(now))
+    return(false);
+
+  uint32_t delay = getFrameDelay();
+
+#if ENA_STATS
+  // how late is this frame? Not meaningful for the first frame of a cycle.
+  if (_fsmState == INITIALISE)
+    _cycleStartTime = now;
+  else
   {
-    Serial.print("\nCycle time: ");
-    Serial.print(millis() - cycleStartTime);
+    uint32_t late = now - _lastRunTime - delay;
+
+    _stats.jitter += late;
+    if (delay != 0 && late >= delay) _stats.overruns++;
+  }
+  frameStart = micros();
+#endif
+
+  // Save the time for this frame before we run the animation, so that the animation
+  // is part of the delay between animations giving more accurate frame timing.
+  // In free running mode this is the time now. In the fixed time step modes it
+  // is the time this frame was due, keeping the animation on a fixed time grid
+  // that is started at the first frame of each cycle.
+  if ((_timingMode == PA_TIMING_FREE) || (_fsmState == INITIALISE) || (delay == 0))
+    _lastRunTime = now;
+  else
+  {
+    uint32_t late;
+
+    _lastRunTime += delay;
+    // too far behind to recover, so forget the oldest missed frames but stay on
+    // the grid with MAX_LATE_FRAMES still overdue to be run
+    late = (now - _lastRunTime) / delay;
+    if (late > MAX_LATE_FRAMES)
+      _lastRunTime += (late - MAX_LATE_FRAMES) * delay;
+  }
+
+  _animationAdvanced = true;    // we now know it will happen!
+
+  // any text to display?
+  if (((_pText != nullptr) || (_cbText != nullptr)) && (_frame != nullptr))
+  {
+    animateFrame();
+
+    // run the overdue frames without displaying them, if allowed
+    if (_timingMode == PA_TIMING_DROP)
+    {
+      uint8_t count = 0;
+
+      while ((_fsmState != END) && (count++ < MAX_LATE_FRAMES) &&
+             ((delay = getFrameDelay()) != 0) && (now - _lastRunTime >= delay))
+      {
+        _lastRunTime += delay;
+        animateFrame();
+      }
+    }
+
+    // write the frame created by the effect to the display
+    flushFrame();
+  }
+
+#if ENA_STATS
+  {
+    uint32_t t = micros() - frameStart;
+
+    if (_stats.frames == 0 || t < _stats.frameTimeMin) _stats.frameTimeMin = t;
+    if (t > _stats.frameTimeMax) _stats.frameTimeMax = t;
+    _stats.frameTimeTotal += t;
+    _stats.frames++;
+    if (_fsmState == END) _stats.cycleTime = now - _cycleStartTime;
   }
 #endif
 
   return(_fsmState == END);
 }
 
+#if ENA_QUEUE
+bool MD_PZone::queueAdd(const queueEntry_t &e)
+{
+  if (_qCount == ZONE_QUEUE_SIZE)
+  {
+    if (_queueOverflow == PA_QUEUE_REJECT)
+      return(false);
+
+    // discard the oldest message to make room
+    _qHead = (_qHead + 1) % ZONE_QUEUE_SIZE;
+    _qCount--;
+  }
+
+  _queue[(_qHead + _qCount) % ZONE_QUEUE_SIZE] = e;
+  _qCount++;
+
+  return(true);
+}
+
+bool MD_PZone::queuePeek(queueEntry_t &e)
+{
+  if (_qCount == 0)
+    return(false);
+
+  e = _queue[_qHead];
+
+  return(true);
+}
+
+void MD_PZone::queueNext(void)
+// Remove the oldest message from the queue and set it up as the
+// current message, ready to start at the next animation frame.
+{
+  queueEntry_t *p = &_queue[_qHead];
+
+  PRINTS("\nqueueNext");
+  setTextBuffer(p->pText);
+  setTextAlignment(p->align);
+  setSpeed(p->speed);
+  setPause(p->pause);
+  setTextEffect(p->effectIn, p->effectOut);
+  zoneReset();
+
+  _qHead = (_qHead + 1) % ZONE_QUEUE_SIZE;
+  _qCount--;
+}
+#endif
+
 #if DEBUG_PAROLA_FSM
 const char *MD_PZone::state2string(fsmState_t s)
 {
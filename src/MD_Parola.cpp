@@ -34,9 +34,10 @@ MD_Parola::~MD_Parola(void)
   // release the dynamically allocated zone array
   delete[] _Z;
 #endif
+  delete[] _textPool;
 }
 
-void MD_Parola::begin(uint8_t numZones)
+void MD_Parola::begin(uint8_t numZones, uint16_t textPoolSize)
 {
   _D.begin();
 
@@ -48,12 +49,27 @@ void MD_Parola::begin(uint8_t numZones)
   _numZones = numZones;
 
 #if !STATIC_ZONES
-  // Create the zone objects array for dynamic zones
+  // Create the zone objects array for dynamic zones, replacing any from an earlier begin()
+  delete[] _Z;
   _Z = new MD_PZone[_numZones];
 #endif
 
+  // Create the text pool, one part for each zone
+  delete[] _textPool;
+  _textPool = nullptr;
+  _textPoolSize = 0;
+  if (textPoolSize != 0)
+  {
+    _textPool = new char[(size_t)_numZones * textPoolSize];
+    _textPoolSize = (_textPool == nullptr ? 0 : textPoolSize);
+  }
+
   for (uint8_t i = 0; i < _numZones; i++)
+  {
     _Z[i].begin(&_D);
+    if (_textPool != nullptr)
+      _Z[i].setTextPool(&_textPool[i * _textPoolSize], _textPoolSize);
+  }
 
   // for one zone automatically make it all modules, user will override if not intended
   if (_numZones == 1)
@@ -69,17 +85,47 @@ void MD_Parola::begin(uint8_t numZones)
   setInvert(false);
 }
 
-bool MD_Parola::setZone(uint8_t z, uint8_t moduleStart, uint8_t moduleEnd)
+bool MD_Parola::setZone(uint8_t z, uint16_t moduleStart, uint16_t moduleEnd)
 {
   if ((moduleStart <= moduleEnd) && (moduleEnd < _numModules) && (z < _numZones))
-  {
-    _Z[z].setZone(moduleStart, moduleEnd);
-    return(true);
-  }
+    return(_Z[z].setZone(moduleStart, moduleEnd));
 
   return(false);
 }
 
+bool MD_Parola::setZoneColumns(uint8_t z, uint16_t columnStart, uint16_t columnEnd)
+{
+  if ((columnStart <= columnEnd) && (columnEnd <= ZONE_END_COL(_numModules - 1)) && (z < _numZones))
+    return(_Z[z].setZoneColumns(columnStart, columnEnd));
+
+  return(false);
+}
+
+#if ENA_CANVAS
+bool MD_Parola::setCanvas(uint8_t rows, bool flipAlternate)
+{
+  if ((rows == 0) || (_numModules % rows != 0))
+    return(false);
+
+  _canvasRows = rows;
+  _canvasFlip = flipAlternate;
+
+  return(true);
+}
+
+bool MD_Parola::setZoneRect(uint8_t z, uint16_t columnStart, uint16_t columnEnd, uint8_t rowStart, uint8_t rowEnd)
+{
+  uint16_t rowWidth = (_numModules / _canvasRows) * COL_SIZE;
+
+  if ((columnStart <= columnEnd) && (columnEnd < rowWidth) &&
+      (rowStart <= rowEnd) && (rowEnd < _canvasRows) && (rowEnd - rowStart < MAX_CANVAS_ROWS) &&
+      (z < _numZones))
+    return(_Z[z].setZoneRect(columnStart, columnEnd, rowStart, rowEnd, rowWidth, _canvasFlip));
+
+  return(false);
+}
+#endif
+
 void MD_Parola::displayZoneText(uint8_t z, const char *pText, textPosition_t align, uint16_t speed, uint16_t pause, textEffect_t effectIn, textEffect_t effectOut)
 {
   setTextBuffer(z, pText);
@@ -91,18 +137,68 @@ void MD_Parola::displayZoneText(uint8_t z, const char *pText, textPosition_t ali
   displayReset(z);
 }
 
-bool MD_Parola::displayAnimate(void)
+#if ENA_QUEUE
+bool MD_Parola::queueZoneText(uint8_t z, const char *pText, textPosition_t align, uint16_t speed, uint16_t pause, textEffect_t effectIn, textEffect_t effectOut)
+{
+  queueEntry_t e;
+
+  if (z >= _numZones)
+    return(false);
+
+  e.pText = pText;
+  e.align = align;
+  e.speed = speed;
+  e.pause = pause;
+  e.effectIn = effectIn;
+  e.effectOut = effectOut;
+
+  return(_Z[z].queueAdd(e));
+}
+#endif
+
+bool MD_Parola::animateZones(uint32_t now)
 {
   bool b = false;
+  bool bSuspended = false;
+
+  for (uint8_t i = 0; i < _numZones; i++)
+  {
+    // suspend the display only once we know a zone will animate a frame
+    if (!bSuspended && _Z[i].isAnimationDue(now))
+    {
+      _D.update(MD_MAX72XX::OFF);
+      bSuspended = true;
+    }
+
+    b |= _Z[i].zoneAnimate(now);
+  }
+
+  // re-enable and update the display if anything was animated
+  if (bSuspended)
+    _D.update(MD_MAX72XX::ON);
+
+  return(b);
+}
 
-  // suspend the display while we animate a frame
-  _D.update(MD_MAX72XX::OFF);
+bool MD_Parola::displayAnimate(void)
+{
+  return(animateZones(clockNow()));
+}
 
+bool MD_Parola::displayAnimate(uint32_t &waitTime)
+{
+  // the clock is read once so the wait is measured from the same time as the animation
+  uint32_t now = clockNow();
+  bool b = animateZones(now);
+
+  // the earliest deadline across all the zones
+  waitTime = WAIT_FOREVER;
   for (uint8_t i = 0; i < _numZones; i++)
-    b |= _Z[i].zoneAnimate();
+  {
+    uint32_t t = _Z[i].getWaitTime(now);
 
-  // re-enable and update the display
-  _D.update(MD_MAX72XX::ON);
+    if (t < waitTime) waitTime = t;
+  }
 
   return(b);
 }
@@ -121,6 +217,18 @@ size_t MD_Parola::write(const char *str)
 size_t MD_Parola::write(const uint8_t *buffer, size_t size)
 // .print() extension
 {
+  // with a text pool, build the string in the zone 0 part of the pool
+  if (_textPool != nullptr)
+  {
+    size_t len = (size < _textPoolSize ? size : _textPoolSize - 1);
+
+    memcpy(_textPool, buffer, len);
+    _textPool[len] = '\0';
+    write(_textPool);
+
+    return(len);
+  }
+
   char *psz = (char *)malloc(sizeof(char) * (size + 1));
 
   if (psz == nullptr) return(0);
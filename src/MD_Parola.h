@@ -50,6 +50,35 @@ Parola A-to-Z Blog Articles
 If you like and use this library please consider making a small donation using [PayPal](https://paypal.me/MajicDesigns/4USD)
 
 \page pageRevHistory Revision History
+Oct 2026 - version 3.6.0
+- Text displayed by commonPrint() is rendered once into a per-zone column cache
+- User defined characters held in a sorted table instead of a linked list
+- displayAnimate() only updates the display when at least one zone animation is due
+- Effects render into a per-zone frame buffer written to the display once per frame
+- Added a host build with an in-memory MD_MAX72XX in extras/host
+- Added a host benchmark of the frame cost of each effect in extras/host
+- Added setClockSource() to replace millis() as the animation time base
+- Added displayAnimate() overload returning the time until the next frame is due
+- Added zone performance counters (ENA_STATS) replacing TIME_PROFILING output
+- Added setTimingMode() for fixed time step animation with catch up or frame drop
+- Added setZoneColumns() to define zones that do not fall on module boundaries
+- Column loops widened to 16 bits, displays are limited to MAX_MODULES modules and zones past the limit are rejected
+- Added multi-row canvas zones (ENA_CANVAS) with setCanvas() and setZoneRect()
+- Added PA_DOUBLE_HEIGHT zone effect for double height text in a canvas zone
+- Added zone message queues (ENA_QUEUE) that start the next message automatically
+- Added optional library text pool allocated in begin(), write() uses it instead of the heap
+- Added setTextSource() to scroll text supplied a character at a time by a callback
+- Added appendText() to add text to a scrolling message without restarting it
+- Added setUTF8() to decode UTF-8 text directly into 16 bit character codes
+- Table driven bit reversal and single pass glyph flipping for flipped zones
+- Effects dispatched through a table indexed by textEffect_t
+- Added PA_CUSTOM text effect and setCustomEffect() for user defined effect functions
+- Added setEffectModifier() to run grow or fade alongside any entry and exit effect
+- Grow and vertical scan masks are applied as the text is printed into the frame
+- Vertical scroll, diagonal scroll and mesh shift each column in one step, a machine word of columns at a time where the columns are bytes
+- PA_RANDOM reveals pixels in a per-zone LFSR order, added setRandomRate()
+- PA_RANDOM is selected with ENA_RANDOM and keeps its pixel mask at the end of the zone frame
+
 Mar 2021 - version 3.5.6
 - Added TG_Combo, TG_Coord and TG_Zones examples
 - Deleted Test_TG example
@@ -260,6 +289,24 @@ of text special effects on the LED matrix.
 The latest copy of this library can be found
 [here] (http://github.com/MajicDesigns/MAX72xx).
 
+### Hardware Interface
+Effects are rendered into zone frame buffers in RAM, so the library only uses a small
+part of the MD_MAX72XX interface:
+- begin(), update(controlValue_t) and control() for SHUTDOWN and INTENSITY.
+- getColumn() to load a zone frame buffer when an animation starts and setColumn() to
+write the columns that have changed since the last frame.
+- setFont(), getChar() and getMaxFontWidth() for character bitmaps.
+- The COL_SIZE and ROW_SIZE definitions and the moduleType_t, controlRequest_t,
+controlValue_t and fontType_t types.
+
+From the Arduino core the library uses the Print class, millis() (unless replaced using
+setClockSource()), random(), pgm_read_byte(), pgm_read_word() and pgm_read_ptr().
+
+The extras/host folder has stand-ins for these interfaces and a CMake build of the library
+for Linux. The MD_MAX72XX stand-in keeps the display in memory, so applications and effects
+can be built, timed and checked on a workstation before the code is loaded onto the hardware.
+Refer to the README.md file in that folder for details.
+
 ___
 
 Display Zones
@@ -307,7 +354,9 @@ Individual characters can be substituted for user character definitions. These c
 deleted to individual zones as required.
 
 The character data is the same format as a single character from the font definition file,
-and is held in a local lookup table that is parsed before loading the defined font character.
+and is held in a local lookup table that is searched before loading the defined font character.
+The table is kept sorted by character code so lookup time grows very slowly with the number
+of user characters defined.
 If a character is specified with a code the same as an existing character, the existing data
 will be substituted for the new data.
 
@@ -350,6 +399,23 @@ specified using the effect id PA_SPRITE.
 
 ___
 
+Custom Text Effect
+------------------
+The PA_CUSTOM text effect runs a user function, set with setCustomEffect(), to build each
+animation frame. This allows application specific transitions without changing the library.
+
+The function is called once for each animation frame with an effectFrame_t structure that
+gives access to the zone frame buffer, the pre-rendered message columns, the frame number
+and the direction of the effect. The frame buffer holds one column for each zone column
+and keeps its contents between calls, so the function can either redraw the frame from the
+message columns every time or incrementally change the previous frame.
+
+The library manages the effect state machine. The frame number restarts from 0 at the
+start of the entry and the exit effect, and the function returns true when the effect
+has finished. The display then pauses (entry) or ends (exit) as for the other effects.
+
+___
+
 Conditional Compilation Switches
 --------------------------------
 The library allows the run time code to be tailored through the use of compilation
@@ -372,7 +438,10 @@ effects:
 - Choose a name for the effect and add it to the textEffect_t enumerated type.
 - Clone an existing method and modify it according to the guidelines below.
 - Add the function prototype for the new effect to the MD_PZone class definition in the MD_Parola.h file.
-- Modify the zoneAnimate() method in MD_PZone.cpp to invoke the new method.
+- Add a function for the new effect to the effect table entries in MD_PZone.cpp, declare
+it with the other entries in the MD_PZone class definition and insert it in the effect table
+at the same position as the new value in textEffect_t. New values go before PA_CUSTOM.
+- Update LAST_EFFECT after textEffect_t if the new effect is the last one in its ENA_* group.
 
 ###New Text Effects
 The effects functions are implemented as finite state machines that are called with the
@@ -385,10 +454,16 @@ With this method, the function will need to use the getFirstChar() and getNextCh
 to build up the displayed text, column by column.
 - *Subtractive*: where the final displayed text is placed in the buffer using the commonPrint()
 method and the elements that are not visible at that stage of the animation are removed.
+When the same LEDs are removed from every column, pass them as a mask to commonPrint() so
+they are never printed, rather than making another pass over the frame.
 
 Which algorithm is used depends on the type animation and what is convenient for the coder.
 Examples of both are found in the supplied library text effects.
 
+Effects do not write to the MD_MAX72XX object directly. All drawing is done in the zone frame
+buffer using the getFrameColumn(), setFrameColumn(), clearFrame() and shiftFrame() methods. The
+frame buffer is written to the display once after the effect method returns.
+
 Each effect method is implemented in 2 parts. One part implements the text move IN to the display
 (method parameter bIn is true) and the other when the text is moving OUT of the display (bIn false).
 Because the IN and OUT effects can be different for a display cycle, the method must not assume
@@ -459,6 +534,27 @@ takes about 1-2ms to update in the MD_MAX72XX display buffers.
 #ifndef ENA_SPRITE
 #define ENA_SPRITE  1   ///< Enable sprite effects
 #endif
+#ifndef ENA_RANDOM
+#define ENA_RANDOM  1   ///< Enable random dots effect
+#endif
+
+// Zone performance counters cost RAM and time for every frame, so they
+// are excluded unless they are needed for tuning an application.
+#ifndef ENA_STATS
+#define ENA_STATS  0    ///< Enable zone performance counters
+#endif
+
+// Zones spanning more than one row of modules need wider column data
+// for every zone, so this is excluded unless the display is stacked.
+#ifndef ENA_CANVAS
+#define ENA_CANVAS 0    ///< Enable multi-row canvas zones
+#endif
+
+// Message queues use RAM in every zone for the queued message parameters,
+// so they are excluded unless messages are fed to the zones this way.
+#ifndef ENA_QUEUE
+#define ENA_QUEUE  0    ///< Enable zone message queues
+#endif
 
 // If function is not used at all, then some memory savings can be made
 // by excluding associated code.
@@ -469,6 +565,16 @@ takes about 1-2ms to update in the MD_MAX72XX display buffers.
 // Miscellaneous defines
 #define ARRAY_SIZE(a) (sizeof(a) / sizeof((a)[0]))  ///< Generic macro for obtaining number of elements of an array
 #define STATIC_ZONES 0    ///< Developer testing flag for quickly flipping between static/dynamic zones
+#define WAIT_FOREVER 0xffffffff ///< Wait time returned when no animation frame is scheduled
+#define UTF8_INVALID 0xfffd ///< Character code for invalid UTF-8 sequences (Unicode replacement character)
+#ifndef MAX_LATE_FRAMES
+#define MAX_LATE_FRAMES 8 ///< Maximum number of overdue frames recovered in the fixed time step timing modes
+#endif
+#ifndef ZONE_QUEUE_SIZE
+#define ZONE_QUEUE_SIZE 4 ///< Number of messages held in each zone message queue
+#endif
+#define RAND_CYCLE 11     ///< PA_RANDOM pixel mask repeats every RAND_CYCLE columns
+#define MAX_MODULES 255   ///< Most modules in a display, MD_MAX72XX device numbers are 8 bits
 
 #if STATIC_ZONES
 #ifndef MAX_ZONES
@@ -476,6 +582,13 @@ takes about 1-2ms to update in the MD_MAX72XX display buffers.
 #endif
 #endif
 
+#if ENA_CANVAS
+#define MAX_CANVAS_ROWS 4   ///< Maximum rows of modules in one zone, limited by the size of colData_t
+typedef uint32_t colData_t; ///< Zone column data, one bit for each LED in the column of a zone
+#else
+typedef uint8_t colData_t;  ///< Zone column data, one bit for each LED in the column of a zone
+#endif
+
 // Zone column calculations
 #define ZONE_START_COL(m) ((m) * COL_SIZE)    ///< The first column of the first zone module
 #define ZONE_END_COL(m)   ((((m) + 1) * COL_SIZE) - 1)///< The last column of the last zone module
@@ -518,8 +631,10 @@ enum textEffect_t
   PA_FADE,        ///< Text enters and exits by fading from/to 0 and intensity setting
   PA_DISSOLVE,    ///< Text dissolves from one display to another
   PA_BLINDS,      ///< Text is replaced behind vertical blinds
-  PA_RANDOM,      ///< Text enters and exits as random dots
 #endif //ENA_MISC
+#if ENA_RANDOM
+  PA_RANDOM,      ///< Text enters and exits as random dots
+#endif //ENA_RANDOM
 #if ENA_WIPE
   PA_WIPE,        ///< Text appears/disappears one column at a time, looks like it is wiped on and off
   PA_WIPE_CURSOR, ///< WIPE with a light bar ahead of the change
@@ -546,8 +661,30 @@ enum textEffect_t
   PA_GROW_UP,     ///< Text grows from the bottom up and shrinks from the top down
   PA_GROW_DOWN,   ///< Text grows from the top down and and shrinks from the bottom up
 #endif // ENA_GROW
+  PA_CUSTOM = 0x7f,   ///< Text enters and exits using the user defined effect function. Fixed value, not changed by the ENA_* switches
 };
 
+// Last textEffect_t value before PA_CUSTOM for the selected ENA_* switches
+#if ENA_GROW
+#define LAST_EFFECT PA_GROW_DOWN          ///< Last effect before PA_CUSTOM, sizes the effect table
+#elif ENA_SCR_DIA
+#define LAST_EFFECT PA_SCROLL_DOWN_RIGHT  ///< Last effect before PA_CUSTOM, sizes the effect table
+#elif ENA_OPNCLS
+#define LAST_EFFECT PA_CLOSING_CURSOR     ///< Last effect before PA_CUSTOM, sizes the effect table
+#elif ENA_SCAN
+#define LAST_EFFECT PA_SCAN_VERTX         ///< Last effect before PA_CUSTOM, sizes the effect table
+#elif ENA_WIPE
+#define LAST_EFFECT PA_WIPE_CURSOR        ///< Last effect before PA_CUSTOM, sizes the effect table
+#elif ENA_RANDOM
+#define LAST_EFFECT PA_RANDOM             ///< Last effect before PA_CUSTOM, sizes the effect table
+#elif ENA_MISC
+#define LAST_EFFECT PA_BLINDS             ///< Last effect before PA_CUSTOM, sizes the effect table
+#elif ENA_SPRITE
+#define LAST_EFFECT PA_SPRITE             ///< Last effect before PA_CUSTOM, sizes the effect table
+#else
+#define LAST_EFFECT PA_SCROLL_RIGHT       ///< Last effect before PA_CUSTOM, sizes the effect table
+#endif
+
 /**
  * Zone effect enumerated type specification.
  *
@@ -557,12 +694,130 @@ enum textEffect_t
  * modules (like Parola or Generic types) to be placed in an inverted position to allow all matrices
  * to be tightly packed into a 2 line display. One of the lines must be flipped horizontally and
  * vertically to remain legible in this configuration.
+ *
+ * The DOUBLE_HEIGHT effect builds each character from two font characters, the lower
+ * half at the character code and the upper half at the code with bit 7 set (code | 0x80),
+ * as in the fonts used for the double height examples. Both halves are animated by the
+ * one zone, so they cannot drift apart. The zone must be a canvas zone at least 2 module
+ * rows high (see setZoneRect()), otherwise the effect is ignored.
  */
 enum zoneEffect_t
 {
   PA_FLIP_UD, ///< Flip the zone Up to Down (effectively upside down). Works with all textEffect_t values
   PA_FLIP_LR, ///< Flip the zone Left to Right (effectively mirrored). Does not work with textEffect_t types SLICE, SCROLL_LEFT, SCROLL_RIGHT
+  PA_DOUBLE_HEIGHT, ///< Display text as double height characters. Only works with ENA_CANVAS zones at least 2 module rows high
+};
+
+/**
+ * Animation timing enumerated type specification.
+ *
+ * Used to define how a zone schedules the next animation frame, especially
+ * when a frame runs late because the application did not call displayAnimate()
+ * in time or other zones took longer than expected.
+ */
+enum timingMode_t
+{
+  PA_TIMING_FREE,     ///< Next frame is due one frame time after the last one actually ran. Any lateness accumulates as drift (default).
+  PA_TIMING_CATCHUP,  ///< Frames are due on a fixed time grid. Overdue frames are each displayed, one per call without waiting, until the animation is back on time.
+  PA_TIMING_DROP,     ///< Frames are due on a fixed time grid. Overdue frames are run in the same call but only the last one is displayed.
+};
+
+#if ENA_STATS
+/**
+ * Zone performance counters.
+ *
+ * Counters accumulated by each zone as it animates, used to find the zones
+ * and effects that are exceeding their frame time budget. The average frame
+ * time is frameTimeTotal/frames. Enabled by setting ENA_STATS to 1.
+ */
+struct zoneStats_t
+{
+  uint32_t frames;          ///< number of animation frames run
+  uint32_t frameTimeMin;    ///< shortest time to run one frame, in microseconds
+  uint32_t frameTimeMax;    ///< longest time to run one frame, in microseconds
+  uint32_t frameTimeTotal;  ///< total time running frames, in microseconds
+  uint32_t overruns;        ///< frames that ran one or more frame times later than due
+  uint32_t jitter;          ///< accumulated time frames ran later than due, in milliseconds
+  uint32_t cycleTime;       ///< time for the last complete animation cycle, in milliseconds
 };
+#endif
+
+#if ENA_QUEUE
+/**
+ * Zone message queue entry.
+ *
+ * The parameters for one message waiting in a zone message queue. These are
+ * the same as the parameters for MD_Parola::displayZoneText(). Enabled by
+ * setting ENA_QUEUE to 1.
+ */
+struct queueEntry_t
+{
+  const char     *pText;    ///< text to display, must remain valid until the message is displayed
+  textPosition_t align;     ///< text alignment
+  uint16_t       speed;     ///< time between animation frames, in milliseconds
+  uint16_t       pause;     ///< pause between entry and exit effects, in milliseconds
+  textEffect_t   effectIn;  ///< the entry effect
+  textEffect_t   effectOut; ///< the exit effect
+};
+
+/**
+ * Message queue overflow enumerated type specification.
+ *
+ * Used to define what happens when a message is added to a full zone message queue.
+ */
+enum queueOverflow_t
+{
+  PA_QUEUE_REJECT,      ///< The new message is not added to the queue (default)
+  PA_QUEUE_DROP_OLDEST, ///< The oldest queued message is discarded to make room for the new message
+};
+#endif
+
+/**
+ * Clock source function prototype.
+ *
+ * A function of this type returns the current time in milliseconds. It is used
+ * by the library to time animation frames and pauses. See MD_Parola::setClockSource().
+ */
+typedef uint32_t (*clockSource_t)(void);
+
+/**
+ * Text source function prototype.
+ *
+ * A function of this type returns the next character code to display, or 0
+ * when there are no more characters in the message. It is used to supply the
+ * text for a zone as it is needed. See MD_Parola::setTextSource().
+ */
+typedef uint16_t (*textSource_t)(void);
+
+/**
+ * Custom effect frame data specification.
+ *
+ * Passed to the custom effect function for each animation frame. Column 0 of
+ * the frame is the rightmost column of the zone and bit 0 of a column is the
+ * top LED. The message column text[i] is placed at frame[textPos - i] when
+ * the message is displayed in its final position.
+ */
+struct effectFrame_t
+{
+  colData_t       *frame;     ///< the zone frame buffer, written to the display after the call
+  uint16_t        frameSize;  ///< number of columns in the frame buffer
+  uint8_t         height;     ///< number of LEDs in each frame column
+  const colData_t *text;      ///< the message columns, leftmost column first, nullptr if none
+  uint16_t        textSize;   ///< number of columns in the text array
+  int16_t         textPos;    ///< frame column for the first message column
+  uint16_t        frameNum;   ///< number of the animation frame, starting at 0 for each of entry and exit
+  bool            bIn;        ///< true for the entry effect, false for the exit effect
+  bool            inverted;   ///< true if the zone display is inverted, see setInvert()
+};
+
+/**
+ * Custom effect function prototype.
+ *
+ * A function of this type builds one animation frame for the PA_CUSTOM text
+ * effect in the frame buffer described by the effectFrame_t structure. It
+ * returns true when the effect has finished. See MD_Parola::setCustomEffect().
+ */
+typedef bool (*customEffect_t)(effectFrame_t *f);
 
 /**
  * Zone object for the Parola library.
@@ -606,9 +861,33 @@ public:
    * Animate using the currently specified text and animation parameters.
    * This method is invoked from the main Parola object.
    *
+   * \param now the current time in milliseconds, read once by the main Parola object.
    * \return bool true if the zone animation has completed, false otherwise.
    */
-  bool zoneAnimate(void);
+  bool zoneAnimate(uint32_t now);
+
+  /**
+   * Check if an animation frame is due.
+   *
+   * Check if the zone timing parameters (speed, pause and suspended state) will allow
+   * an animation frame to run the next time zoneAnimate() is invoked. This is used by
+   * the main Parola object to only suspend and update the display when at least one
+   * zone is going to change it.
+   *
+   * \param now the current time in milliseconds, read once by the main Parola object.
+   * \return bool true if the zone will animate a frame, false otherwise.
+   */
+  bool isAnimationDue(uint32_t now);
+
+  /**
+   * Get the time until the next animation frame is due.
+   *
+   * See comments for the MD_Parola displayAnimate() method with a wait time parameter.
+   *
+   * \param now the current time in milliseconds.
+   * \return the time in milliseconds before a frame is due, 0 if it is due now or WAIT_FOREVER if not scheduled.
+   */
+  uint32_t getWaitTime(uint32_t now);
 
   /**
    * Get the completion status.
@@ -629,7 +908,7 @@ public:
    * \param zStart  value for the start module number placed here [0..numZones-1].
    * \param zEnd  value for the end module number placed here [0..numZones-1].
    */
-  inline void getZone(uint8_t &zStart, uint8_t &zEnd) { zStart = _zoneStart; zEnd = _zoneEnd; }
+  inline void getZone(uint16_t &zStart, uint16_t &zEnd) { zStart = _zoneStart; zEnd = _zoneEnd; }
 
   /**
   * Check if animation frame has advanced.
@@ -648,7 +927,7 @@ public:
    *
    * \return No return value.
    */
-  void zoneClear(void) { _MX->clear(_zoneStart, _zoneEnd); if (_inverted) _MX->transform(_zoneStart, _zoneEnd, MD_MAX72XX::TINV); }
+  void zoneClear(void) { clearFrame(); _shadowValid = false; flushFrame(); }
 
   /**
    * Reset the current zone animation to restart.
@@ -657,7 +936,7 @@ public:
    *
    * \return No return value.
    */
-  inline void zoneReset(void) { _fsmState = INITIALISE; }
+  inline void zoneReset(void) { _fsmState = INITIALISE; _tCacheValid = false; _shadowValid = false; }
 
   /**
   * Shutdown or resume zone hardware.
@@ -667,7 +946,7 @@ public:
   * \param b  boolean value to shutdown (true) or resume (false).
   * \return No return value.
   */
-  void zoneShutdown(bool b) { _MX->control(_zoneStart, _zoneEnd, MD_MAX72XX::SHUTDOWN, b ? MD_MAX72XX::ON : MD_MAX72XX::OFF); }
+  void zoneShutdown(bool b) { zoneControl(MD_MAX72XX::SHUTDOWN, b ? MD_MAX72XX::ON : MD_MAX72XX::OFF); }
 
   /**
    * Suspend or resume zone updates.
@@ -677,7 +956,7 @@ public:
    * \param b boolean value to suspend (true) or resume (false).
    * \return No return value.
    */
-  inline void zoneSuspend(bool b) { _suspend = b; }
+  inline void zoneSuspend(bool b) { if (!b) _shadowValid = false; _suspend = b; }
 
   /**
    * Set the start and end parameters for a zone.
@@ -686,8 +965,37 @@ public:
    *
    * \param zStart  the first module number for the zone [0..numZones-1].
    * \param zEnd  the last module number for the zone [0..numZones-1].
+   * \return true if set, false if the modules are out of order or past MAX_MODULES.
    */
-  inline void setZone(uint8_t zStart, uint8_t zEnd) { _zoneStart = zStart; _zoneEnd = zEnd; }
+  bool setZone(uint16_t zStart, uint16_t zEnd) { return(zEnd < MAX_MODULES && setZoneColumns(ZONE_START_COL(zStart), ZONE_END_COL(zEnd))); }
+
+  /**
+   * Set the start and end columns for a zone.
+   *
+   * See comments for the MD_Parola namesake method.
+   *
+   * \param cStart  the first display column for the zone.
+   * \param cEnd  the last display column for the zone.
+   * \return true if set, false if the columns are out of order or past MAX_MODULES.
+   */
+  bool setZoneColumns(uint16_t cStart, uint16_t cEnd);
+
+#if ENA_CANVAS
+  /**
+   * Set the zone as a rectangle of a multi-row canvas.
+   *
+   * See comments for the MD_Parola namesake method.
+   *
+   * \param cStart  the first canvas column for the zone.
+   * \param cEnd  the last canvas column for the zone.
+   * \param rStart  the first (lowest) module row for the zone.
+   * \param rEnd  the last (highest) module row for the zone.
+   * \param rowWidth  the number of display columns in each module row.
+   * \param rowFlip  true if odd module rows are mounted rotated by 180 degrees.
+   * \return true if set, false if the zone is out of order or reaches past MAX_MODULES.
+   */
+  bool setZoneRect(uint16_t cStart, uint16_t cEnd, uint8_t rStart, uint8_t rEnd, uint16_t rowWidth, bool rowFlip);
+#endif
 
   /** @} */
   //--------------------------------------------------------------
@@ -766,6 +1074,15 @@ public:
    * \return the speed value.
    */
   inline uint16_t getSpeedOut(void) { return _tickTimeOut; }
+
+  /**
+   * Get the zone animation timing mode.
+   *
+   * See the setTimingMode() method.
+   *
+   * \return the timing mode.
+   */
+  inline timingMode_t getTimingMode(void) { return _timingMode; }
   
   /**
   * Get the zone animation start time.
@@ -813,7 +1130,7 @@ public:
    * \param cs  space between characters in columns.
    * \return No return value.
    */
-  inline void setCharSpacing(uint8_t cs) { _charSpacing = cs; allocateFontBuffer(); }
+  inline void setCharSpacing(uint8_t cs) { _charSpacing = cs; _tCacheValid = false; allocateFontBuffer(); }
 
   /**
    * Set the zone brightness.
@@ -823,7 +1140,7 @@ public:
    * \param intensity the intensity to set the display (0-15).
    * \return No return value.
    */
-  inline void setIntensity(uint8_t intensity) { _intensity = intensity; _MX->control(_zoneStart, _zoneEnd, MD_MAX72XX::INTENSITY, _intensity); }
+  inline void setIntensity(uint8_t intensity) { _intensity = intensity; zoneControl(MD_MAX72XX::INTENSITY, _intensity); }
 
   /**
    * Invert the zone display.
@@ -887,6 +1204,16 @@ public:
    */
   inline void setSpeedInOut(uint16_t speedIn, uint16_t speedOut) { _tickTimeIn = speedIn; _tickTimeOut = speedOut; }
 
+  /**
+   * Set the zone animation timing mode.
+   *
+   * See comments for the MD_Parola namesake method.
+   *
+   * \param tm the timing mode, one of the timingMode_t enumerated values.
+   * \return No return value.
+   */
+  inline void setTimingMode(timingMode_t tm) { _timingMode = tm; }
+
 #if ENA_SPRITE
   /**
   * Set data for user sprite effects.
@@ -906,6 +1233,28 @@ public:
                      const uint8_t *outData, uint8_t outWidth, uint8_t outFrames);
 #endif
 
+  /**
+  * Set the custom effect function for this zone.
+  *
+  * See the comments for the namesake method in MD_Parola.
+  *
+  * \param cb  the custom effect function, nullptr for none.
+  * \return No return value.
+  */
+  inline void setCustomEffect(customEffect_t cb) { _cbEffect = cb; }
+
+#if ENA_RANDOM
+  /**
+  * Set the PA_RANDOM effect rate for this zone.
+  *
+  * See the comments for the namesake method in MD_Parola.
+  *
+  * \param pixels the number of pixels changed in each animation frame.
+  * \return No return value.
+  */
+  inline void setRandomRate(uint8_t pixels) { _randRate = (pixels == 0 ? 1 : pixels); }
+#endif
+
   /**
   * Set the zone animation start time.
   *
@@ -940,7 +1289,39 @@ public:
    * \param pb  pointer to the text buffer to be used.
    * \return No return value.
    */
-  inline void setTextBuffer(const char *pb) { _pText = (const uint8_t *)pb; }
+  void setTextBuffer(const char *pb);
+
+  /**
+   * Set the text pool buffer for this zone.
+   *
+   * When a text pool is set, text passed to setTextBuffer() is copied
+   * into the pool rather than used in place. Called by MD_Parola::begin().
+   *
+   * \param pool  pointer to the zone's part of the text pool, nullptr for none.
+   * \param size  the size of the pool buffer in bytes.
+   * \return No return value.
+   */
+  inline void setTextPool(char *pool, uint16_t size) { _textPool = pool; _textPoolSize = size; }
+
+  /**
+   * Set the text source callback for this zone.
+   *
+   * See the comments for the namesake method in MD_Parola.
+   *
+   * \param cb  the callback function, nullptr to stop using it.
+   * \return No return value.
+   */
+  inline void setTextSource(textSource_t cb) { _cbText = cb; _pText = nullptr; _tCacheValid = false; }
+
+  /**
+   * Append text to the message for this zone.
+   *
+   * See the comments for the namesake method in MD_Parola.
+   *
+   * \param p  pointer to the text to append.
+   * \return true if the text was appended, false otherwise.
+   */
+  bool appendText(const char *p);
 
   /**
    * Set the entry and exit text effects for the zone.
@@ -953,6 +1334,23 @@ public:
    */
   inline void setTextEffect(textEffect_t effectIn, textEffect_t effectOut) { _effectIn = (effectIn == PA_NO_EFFECT ? PA_PRINT : effectIn), _effectOut = effectOut; }
 
+  /**
+   * Set the effect modifier for the zone.
+   *
+   * See the comments for the namesake method in MD_Parola.
+   *
+   * \param mod the modifier effect, PA_NO_EFFECT for none.
+   * \return No return value.
+   */
+  inline void setEffectModifier(textEffect_t mod) { _modEffect = mod; }
+
+  /**
+   * Get the effect modifier for the zone.
+   *
+   * \return the modifier effect, PA_NO_EFFECT for none.
+   */
+  inline textEffect_t getEffectModifier(void) { return(_modEffect); }
+
   /**
    * Set the zone display effect.
    *
@@ -1020,9 +1418,101 @@ public:
    * \param fontDef Pointer to the font definition to be used.
    * \return No return value.
    */
-  void setZoneFont(MD_MAX72XX::fontType_t *fontDef) { _fontDef = fontDef; _MX->setFont(_fontDef); allocateFontBuffer(); }
+  void setZoneFont(MD_MAX72XX::fontType_t *fontDef) { _fontDef = fontDef; _MX->setFont(_fontDef); _tCacheValid = false; allocateFontBuffer(); }
+
+  /**
+   * Get the UTF-8 decoding setting for the zone.
+   *
+   * \return true if the text is decoded as UTF-8.
+   */
+  inline bool getUTF8(void) { return(_utf8); }
+
+  /**
+   * Set UTF-8 decoding for the zone text.
+   *
+   * See comments for the namesake Parola method.
+   *
+   * \param b  true to decode the text as UTF-8, false for single byte characters.
+   * \return No return value.
+   */
+  inline void setUTF8(bool b) { _utf8 = b; _tCacheValid = false; }
+
+  /** @} */
+
+#if ENA_STATS
+  //--------------------------------------------------------------
+  /** \name Support methods for performance counters.
+  * @{
+  */
+  /**
+  * Get the zone performance counters.
+  *
+  * See comments for the MD_Parola namesake method.
+  *
+  * \param s  the structure to receive a copy of the counters.
+  */
+  void getZoneStats(zoneStats_t &s) { s = _stats; }
+
+  /**
+  * Reset the zone performance counters.
+  *
+  * See comments for the MD_Parola namesake method.
+  */
+  void resetZoneStats(void) { memset(&_stats, 0, sizeof(_stats)); }
+
+  /** @} */
+#endif
+
+#if ENA_QUEUE
+  //--------------------------------------------------------------
+  /** \name Support methods for message queues.
+  * @{
+  */
+  /**
+  * Add a message to the end of the zone message queue.
+  *
+  * See comments for the MD_Parola namesake method.
+  *
+  * \param e  the message parameters.
+  * \return true if the message was queued, false otherwise.
+  */
+  bool queueAdd(const queueEntry_t &e);
+
+  /**
+  * Remove all the messages from the zone message queue.
+  *
+  * See comments for the MD_Parola namesake method.
+  */
+  inline void queueClear(void) { _qHead = _qCount = 0; }
+
+  /**
+  * Get the next message in the zone message queue.
+  *
+  * See comments for the MD_Parola namesake method.
+  *
+  * \param e  the structure to receive a copy of the message parameters.
+  * \return true if there is a queued message, false otherwise.
+  */
+  bool queuePeek(queueEntry_t &e);
+
+  /**
+  * Get the number of messages in the zone message queue.
+  *
+  * \return the number of queued messages.
+  */
+  inline uint8_t getQueueCount(void) { return(_qCount); }
+
+  /**
+  * Set the zone message queue overflow policy.
+  *
+  * See comments for the MD_Parola namesake method.
+  *
+  * \param qo  one of the queueOverflow_t enumerated values.
+  */
+  inline void setQueueOverflow(queueOverflow_t qo) { _queueOverflow = qo; }
 
   /** @} */
+#endif
 
 #if ENA_GRAPHICS
   //--------------------------------------------------------------
@@ -1039,7 +1529,7 @@ public:
   * \param endColumn the by-reference parameter that will hold the return value for the end column.
   * \return The start and end columns in the by-reference parameters.
   */
-  void getZoneExtent(uint16_t &startColumn, uint16_t &endColumn) { startColumn = ZONE_START_COL(_zoneStart); endColumn = ZONE_END_COL(_zoneEnd); }
+  void getZoneExtent(uint16_t &startColumn, uint16_t &endColumn) { startColumn = _colStart; endColumn = _colEnd; }
 
   /**
   * Get the start and end column numbers for the text displayed.
@@ -1072,13 +1562,12 @@ private:
   };
 
   /***
-    *  Structure for list of user defined characters substitutions.
+    *  Structure for table of user defined characters substitutions.
   */
   struct charDef_t
   {
     uint16_t   code;  ///< the ASCII code for the user defined character
     uint8_t   *data;  ///< user supplied data
-    charDef_t *next;  ///< next in the list
   };
 
   MD_MAX72XX  *_MX;   ///< Pointer to parent's MD_MAX72xx object passed in at begin()
@@ -1089,6 +1578,22 @@ private:
   uint16_t  _tickTimeIn;  // the time between IN animations in milliseconds
   uint16_t  _tickTimeOut; // the time between OUT animations in milliseconds
   uint16_t  _pauseTime;   // time to pause the animation between 'in' and 'out'
+  timingMode_t _timingMode; // how the next frame time is scheduled
+
+  uint32_t  getFrameDelay(void);  // time between frames in the current state
+  void      animateFrame(void);   // run the current effect for one frame
+#if ENA_STATS
+  zoneStats_t _stats;       // performance counters
+  uint32_t  _cycleStartTime;// time the current animation cycle started
+#endif
+#if ENA_QUEUE
+  queueEntry_t _queue[ZONE_QUEUE_SIZE]; // ring buffer of messages waiting to be displayed
+  uint8_t   _qHead;         // index of the oldest queued message
+  uint8_t   _qCount;        // number of queued messages
+  queueOverflow_t _queueOverflow; // what to do when adding to a full queue
+
+  void      queueNext(void);  // start the oldest queued message
+#endif
 
   // Display control data and methods
   fsmState_t      _fsmState;          // fsm state for all FSMs used to display text
@@ -1110,8 +1615,10 @@ private:
   bool      calcTextLimits(const uint8_t *p); // calculate the right and left limits for the text
 
   // Variables used in the effects routines. These can be used by the functions as needed.
-  uint8_t   _zoneStart;   // First zone module number
-  uint8_t   _zoneEnd;     // Last zone module number
+  uint16_t  _zoneStart;   // First zone module number
+  uint16_t  _zoneEnd;     // Last zone module number
+  uint16_t  _colStart;    // First zone column number
+  uint16_t  _colEnd;      // Last zone column number
   int16_t   _nextPos;     // Next position for animation. Can be used in several different ways depending on the function.
   int8_t    _posOffset;   // Looping increment depends on the direction of the scan for animation
   int16_t   _startPos;    // Start position for the text LED
@@ -1119,19 +1626,72 @@ private:
 
   void setInitialEffectConditions(void); // set the initial conditions for loops in the FSM
 
+  // Frame buffer handling data and methods.
+  // Effects render into _frame, which holds one colData_t per zone column starting
+  // at _colStart. The frame is written to the display once at the end of each
+  // animation frame. Column parameters are display column numbers, or canvas
+  // column numbers for a zone that spans more than one row of modules.
+  colData_t *_frame;      // zone frame buffer
+  uint16_t  _frameSize;   // number of columns in the frame buffer
+  colData_t *_shadow;     // frame data last written to the display by flushFrame()
+  bool      _shadowValid; // true if _shadow matches the display, cleared when the display may have been written outside the zone
+
+  inline colData_t getFrameColumn(int16_t c) { c -= _colStart; return((c >= 0 && c < (int16_t)_frameSize) ? _frame[c] : 0); }
+#if ENA_CANVAS
+  inline void setFrameColumn(int16_t c, colData_t v) { c -= _colStart; if (c >= 0 && c < (int16_t)_frameSize) _frame[c] = v & _colMask; }
+#else
+  inline void setFrameColumn(int16_t c, colData_t v) { c -= _colStart; if (c >= 0 && c < (int16_t)_frameSize) _frame[c] = v; }
+#endif
+  void      allocateFrame(void);      // allocate the frame buffer for the zone columns
+  void      clearFrame(void);         // set all frame columns to blank
+  void      shiftFrame(bool bLeft);   // shift the frame one column left or right, blank column shifted in
+  void      shiftFrameBits(bool bUp, uint8_t n, int16_t cols); // shift the frame columns n LEDs up or down and cols columns across
+  void      loadFrame(void);          // copy the current display contents into the frame
+  void      flushFrame(void);         // write the changed frame columns to the display
+  void      zoneControl(MD_MAX72XX::controlRequest_t mode, int value); // control request for all the zone modules
+  static uint8_t deviceNum(uint16_t m) { return((uint8_t)m); } // module number as an MD_MAX72XX device number, zones never reach MAX_MODULES
+
+#if ENA_CANVAS
+  // Canvas handling data and methods.
+  // A canvas zone is _zoneRows rows of modules high, each module row being _rowWidth
+  // columns of the display chain. Row 0 is the first in the chain and is at the
+  // bottom. Frame column bits 0-7 are the top row of the zone.
+  uint8_t   _zoneRows;    // number of module rows in the zone
+  uint8_t   _rowBase;     // first (lowest) module row in the zone
+  uint16_t  _rowWidth;    // display columns in each module row, 0 for a single row zone
+  bool      _rowFlip;     // odd module rows are mounted rotated 180 degrees
+  colData_t _colMask;     // all the LEDs in a zone column
+  uint8_t   _textShift;   // bits to shift single row text down to center it in the zone
+  uint8_t   *_fBuf;       // buffer for loading single row character font data, 2 characters long
+
+  uint16_t  displayColumn(uint8_t row, uint16_t c); // display column for canvas column c in module row
+  bool      isDoubleHeight(void);  // true if characters are made from upper and lower font halves
+#endif
+
   // Character buffer handling data and methods
   const uint8_t *_pText;             // pointer to text buffer from user call
+  char       *_textPool;             // library owned copy of the text, nullptr if not used
+  uint16_t   _textPoolSize;          // size of the text pool buffer including the terminating nul
   const uint8_t *_pCurChar;          // the current character being processed in the text
+  bool       _utf8;                  // true if the text is decoded as UTF-8
+  textSource_t _cbText;              // callback supplying the text, nullptr if the text buffer is used
+  customEffect_t _cbEffect;          // user function for the PA_CUSTOM effect
+  uint16_t   _nextCode;              // look ahead character read from the text source
   bool       _endOfText;             // true when the end of the text string has been reached.
   void       moveTextPointer(void);  // move the text pointer depending on direction of buffer scan
+  uint16_t   charCode(const uint8_t *p);         // the character code for the text at p
+  const uint8_t *nextChar(const uint8_t *p);     // the start of the character after p
+  const uint8_t *prevChar(const uint8_t *p);     // the start of the character before p
 
   bool getFirstChar(uint8_t &len);   // put the first Text char into the char buffer
   bool getNextChar(uint8_t &len);    // put the next Text char into the char buffer
 
   // Font character handling data and methods
-  charDef_t *_userChars;  // the root of the list of user defined characters
+  charDef_t *_userChars;      // table of user defined characters, sorted by code
+  uint16_t  _userCharCount;   // number of entries used in the _userChars table
+  uint16_t  _userCharSize;    // allocated number of entries in the _userChars table
   uint8_t   _cBufSize;    // allocated size of the array for loading character font (cBuf)
-  uint8_t   *_cBuf;       // buffer for loading character font - allocated when font is set
+  colData_t *_cBuf;       // buffer for loading character font - allocated when font is set
   uint8_t   _charSpacing; // spacing in columns between characters
   uint8_t   _charCols;    // number of columns for this character
   int16_t   _countCols;   // count of number of columns already shown
@@ -1139,9 +1699,35 @@ private:
 
   void      allocateFontBuffer(void); // allocate _cBuf based on the size of the largest font characters
   uint8_t   findChar(uint16_t code, uint8_t size, uint8_t *cBuf); // look for user defined character
+  uint16_t  findUserChar(uint16_t code);  // index of the user character code or its insertion point in _userChars
   uint8_t   makeChar(uint16_t c, bool addBlank);  // load a character bitmap and add in trailing _charSpacing blanks if req'd
-  void      reverseBuf(uint8_t *p, uint8_t size); // reverse the elements of the buffer
-  void      invertBuf(uint8_t *p, uint8_t size);  // invert the elements of the buffer
+  void      flipBuf(colData_t *p, uint8_t size, bool bReverse, bool bInvert); // reverse and/or invert the elements of the buffer in one pass
+  colData_t invertCol(colData_t c);               // invert a column top to bottom
+  static uint8_t bitReverse(uint8_t v);           // reverse the order of the bits in a byte
+
+  // Text cache handling data and methods.
+  // The message columns displayed by commonPrint() are rendered once into _tCache
+  // and reused for every frame until the text, font or display attributes change.
+  colData_t *_tCache;         // pre-rendered text columns, leftmost column first
+  uint16_t  _tCacheSize;      // allocated size of the _tCache array
+  bool      _tCacheValid;     // true if _tCache holds the current text rendering
+  bool      _tCacheReversed;  // true if _tCache was rendered in reversed character order
+
+  bool      isTextReversed(void);  // true if the text is processed from the end of the string
+  textEffect_t activeEffect(void)   // effect for the current motion, text from a source can only scroll left in or out
+    { if (_cbText != nullptr) return((_moveIn || _effectOut == PA_SCROLL_LEFT) ? PA_SCROLL_LEFT : PA_NO_EFFECT); return(_moveIn ? _effectIn : _effectOut); }
+  void      cacheText(void);       // render the text between _limitLeft and _limitRight into _tCache
+
+  // Random effect data.
+  // The pixels are revealed in the order of a maximal length LFSR sequence
+  // that covers the RAND_CYCLE column mask, so no pixel is picked twice.
+  // The mask is held in RAND_CYCLE extra columns allocated after the frame.
+#if ENA_RANDOM
+  colData_t *randMask(void) { return(&_frame[_frameSize]); } // mask of the pixels revealed, repeated every RAND_CYCLE columns
+  uint16_t  _randState;   // LFSR state, the next pixel to reveal
+  uint16_t  _randCount;   // number of pixels still to reveal
+  uint8_t   _randRate;    // number of pixels revealed each frame
+#endif
 
   /// Sprite management
 #if ENA_SPRITE
@@ -1153,8 +1739,70 @@ private:
   // Debugging aid
   const char *state2string(fsmState_t s);
 
+  // Effect dispatch. The table is indexed by textEffect_t and holds one entry
+  // for each effect enabled by the ENA_* switches, calling the effect method
+  // with the options for that effect.
+  typedef void (*effectFn_t)(MD_PZone *z, bool bIn);  // effect table entry
+  static const effectFn_t _effectTable[];             // effect functions, in textEffect_t order
+  static void fnPrint(MD_PZone *z, bool bIn);
+  static void fnScrollUp(MD_PZone *z, bool bIn);
+  static void fnScrollDown(MD_PZone *z, bool bIn);
+  static void fnScrollLeft(MD_PZone *z, bool bIn);
+  static void fnScrollRight(MD_PZone *z, bool bIn);
+#if ENA_SPRITE
+  static void fnSprite(MD_PZone *z, bool bIn);
+#endif // ENA_SPRITE
+#if ENA_MISC
+  static void fnSlice(MD_PZone *z, bool bIn);
+  static void fnMesh(MD_PZone *z, bool bIn);
+  static void fnFade(MD_PZone *z, bool bIn);
+  static void fnDissolve(MD_PZone *z, bool bIn);
+  static void fnBlinds(MD_PZone *z, bool bIn);
+#endif // ENA_MISC
+#if ENA_RANDOM
+  static void fnRandom(MD_PZone *z, bool bIn);
+#endif // ENA_RANDOM
+#if ENA_WIPE
+  static void fnWipe(MD_PZone *z, bool bIn);
+  static void fnWipeCursor(MD_PZone *z, bool bIn);
+#endif // ENA_WIPE
+#if ENA_SCAN
+  static void fnScanHoriz(MD_PZone *z, bool bIn);
+  static void fnScanHorizX(MD_PZone *z, bool bIn);
+  static void fnScanVert(MD_PZone *z, bool bIn);
+  static void fnScanVertX(MD_PZone *z, bool bIn);
+#endif // ENA_SCAN
+#if ENA_OPNCLS
+  static void fnOpening(MD_PZone *z, bool bIn);
+  static void fnOpeningCursor(MD_PZone *z, bool bIn);
+  static void fnClosing(MD_PZone *z, bool bIn);
+  static void fnClosingCursor(MD_PZone *z, bool bIn);
+#endif // ENA_OPNCLS
+#if ENA_SCR_DIA
+  static void fnScrollUpLeft(MD_PZone *z, bool bIn);
+  static void fnScrollUpRight(MD_PZone *z, bool bIn);
+  static void fnScrollDownLeft(MD_PZone *z, bool bIn);
+  static void fnScrollDownRight(MD_PZone *z, bool bIn);
+#endif // ENA_SCR_DIA
+#if ENA_GROW
+  static void fnGrowUp(MD_PZone *z, bool bIn);
+  static void fnGrowDown(MD_PZone *z, bool bIn);
+#endif // ENA_GROW
+
+  // Effect modifier handling data and methods.
+  // The modifier mask stage is applied by flushFrame() as the frame is written to
+  // the display and the intensity stage once per frame, leaving _frame unchanged.
+  textEffect_t _modEffect;  // modifier effect, PA_NO_EFFECT for none
+  int16_t   _modStep;       // animation step of the modifier
+  bool      _modIn;         // true if the modifier is running with the entry effect
+  bool      _modHold;       // true while the zone is in PAUSE waiting for the entry modifier to finish
+  colData_t _stageMask;     // LEDs shown in each column by the mask stage
+  uint8_t   _stageIntensity; // intensity set by the intensity stage, 0xff if not changed
+
+  bool      modifierStage(void);  // set up the modifier stages for this frame, true when finished
+
   // Effect functions
-  void  commonPrint(void);
+  void  commonPrint(colData_t keep = ~(colData_t)0);
   void  effectPrint(bool bIn);
   void  effectVScroll(bool bUp, bool bIn);
   void  effectHScroll(bool bLeft, bool bIn);
@@ -1164,8 +1812,10 @@ private:
   void  effectFade(bool bIn);
   void  effectBlinds(bool bIn);
   void  effectDissolve(bool bIn);
-  void  effectRandom(bool bIn);
 #endif // ENA_MISC
+#if ENA_RANDOM
+  void  effectRandom(bool bIn);
+#endif // ENA_RANDOM
 #if ENA_SPRITE
   void  effectSprite(bool bIn, uint8_t id);
 #endif // ENA_SPRITE
@@ -1186,6 +1836,7 @@ private:
 #if ENA_GROW
   void  effectGrow(bool bUp, bool bIn);
 #endif // ENA_GROW
+  void  effectCustom(bool bIn);
 };
 
 /**
@@ -1207,10 +1858,18 @@ public:
    * \param dataPin   output on the Arduino where data gets shifted out.
    * \param clkPin    output for the clock signal.
    * \param csPin     output for selecting the device.
-   * \param numDevices  number of devices connected. Default is 1 if not supplied.
+   * \param numDevices  number of devices connected [1..MAX_MODULES]. Default is 1 if not supplied.
    */
   MD_Parola(MD_MAX72XX::moduleType_t mod, uint8_t dataPin, uint8_t clkPin, uint8_t csPin, uint8_t numDevices = 1):
-    _D(mod, dataPin, clkPin, csPin, numDevices), _numModules(numDevices)
+    _D(mod, dataPin, clkPin, csPin, numDevices),
+#if !STATIC_ZONES
+    _Z(nullptr),
+#endif
+    _numModules(numDevices), _cbClock(nullptr),
+    _textPool(nullptr), _textPoolSize(0)
+#if ENA_CANVAS
+    , _canvasRows(1), _canvasFlip(false)
+#endif
   {}
 
   /**
@@ -1223,10 +1882,18 @@ public:
    *
    * \param mod       the hardware module type used in the application. One of the MD_MAX72XX::moduleType_t values.
    * \param csPin   output for selecting the device.
-   * \param numDevices  number of devices connected. Default is 1 if not supplied.
+   * \param numDevices  number of devices connected [1..MAX_MODULES]. Default is 1 if not supplied.
    */
   MD_Parola(MD_MAX72XX::moduleType_t mod, uint8_t csPin, uint8_t numDevices = 1):
-    _D(mod, csPin, numDevices), _numModules(numDevices)
+    _D(mod, csPin, numDevices),
+#if !STATIC_ZONES
+    _Z(nullptr),
+#endif
+    _numModules(numDevices), _cbClock(nullptr),
+    _textPool(nullptr), _textPoolSize(0)
+#if ENA_CANVAS
+    , _canvasRows(1), _canvasFlip(false)
+#endif
   {}
 
   /**
@@ -1247,11 +1914,20 @@ public:
    * zones are initialized separately using setZone(), which should be done immediately after
    * the invoking begin().
    *
-   * \sa setZone()
+   * If textPoolSize is not zero, the library allocates a text pool of textPoolSize
+   * bytes for each zone. Text passed to setTextBuffer() and the display methods is
+   * then copied into the pool, truncated to textPoolSize-1 characters if necessary,
+   * and the application buffer does not need to remain valid while it is displayed.
+   * No further memory is allocated by the library when text is set or printed.
+   *
+   * Calling begin() again releases the zones and text pool from the earlier call.
    *
-   * \param numZones  maximum number of zones
+   * \sa setZone(), setTextBuffer()
+   *
+   * \param numZones      maximum number of zones
+   * \param textPoolSize  size of the text pool for each zone in bytes, 0 for no pool
    */
-  void begin(uint8_t numZones);
+  void begin(uint8_t numZones, uint16_t textPoolSize = 0);
 
   /**
    * Class Destructor.
@@ -1281,11 +1957,35 @@ public:
    * Not all calls to this method result in an animation, as this is governed by
    * the timing parameters set for the animation. To determine when an animation has
    * advanced during the call, the user code can call the isAnimationAdvanced() method.
+   * The display hardware is only updated when at least one zone animation is due, so
+   * calls that do not advance any zone do not send data to the LED modules.
+   *
+   * The current time is read once from the clock source (see setClockSource()) at
+   * the start of each call and shared by all the zones.
    *
    * \return bool true if at least one zone animation has completed, false otherwise.
    */
   bool displayAnimate(void);
 
+  /**
+   * Animate the display and get the time to the next animation frame.
+   *
+   * Identical to displayAnimate() but also returns the time until the earliest of
+   * the zones is next due to animate, taking into account the IN and OUT speeds,
+   * the pause between animations and suspended zones. The calling program can use
+   * this time to sleep, yield to other tasks or enter a low power mode instead of
+   * continuously calling displayAnimate().
+   *
+   * Zones that have completed their animation or are suspended are not scheduled.
+   * If no zone is scheduled the wait time is set to WAIT_FOREVER and the application
+   * must change the zone state (eg, call displayReset() or displaySuspend(false))
+   * before animation will resume.
+   *
+   * \param waitTime the time in milliseconds until the next frame is due, placed here.
+   * \return bool true if at least one zone animation has completed, false otherwise.
+   */
+  bool displayAnimate(uint32_t &waitTime);
+
   /**
    * Get the completion status for a zone.
    *
@@ -1382,6 +2082,21 @@ public:
   */
   bool isAnimationAdvanced(void) { bool b = false; for (uint8_t i = 0; i < _numZones; i++) b |= _Z[i].isAnimationAdvanced(); return(b); }
 
+  /**
+  * Set the clock source for animation timing.
+  *
+  * By default all animation timing is based on the Arduino millis() function.
+  * This method sets a user function that returns the time in milliseconds to be
+  * used instead, allowing the animation to be driven from an external frame clock
+  * or time to be advanced artificially (eg, for testing).
+  *
+  * The clock source is read once at the start of each displayAnimate() call.
+  *
+  * \param cb  the clock source function, or nullptr to revert to millis().
+  * \return No return value.
+  */
+  void setClockSource(clockSource_t cb) { _cbClock = cb; }
+
   /**
    * Get the module limits for a zone.
    *
@@ -1394,7 +2109,19 @@ public:
    * \param moduleStart returns the first module number for the zone [0..numZones-1].
    * \param moduleEnd   returns last module number for the zone [0..numZones-1].
    */
-  inline void getZone(uint8_t z, uint8_t &moduleStart, uint8_t &moduleEnd) { if (z < _numZones) _Z[z].getZone(moduleStart, moduleEnd); }
+  inline void getZone(uint8_t z, uint16_t &moduleStart, uint16_t &moduleEnd) { if (z < _numZones) _Z[z].getZone(moduleStart, moduleEnd); }
+
+  /**
+   * Get the module limits for a zone.
+   *
+   * Variant of getZone() for existing code that uses 8 bit module numbers.
+   * Module numbers are always less than MAX_MODULES so nothing is lost.
+   *
+   * \param z   zone number.
+   * \param moduleStart returns the first module number for the zone [0..numZones-1].
+   * \param moduleEnd   returns last module number for the zone [0..numZones-1].
+   */
+  inline void getZone(uint8_t z, uint8_t &moduleStart, uint8_t &moduleEnd) { uint16_t s, e; getZone(z, s, e); moduleStart = s; moduleEnd = e; }
 
   /**
    * Define the module limits for a zone.
@@ -1416,7 +2143,81 @@ public:
    * \param moduleEnd   the last module number for the zone [0..numZones-1].
    * \return true if set, false otherwise.
    */
-  bool setZone(uint8_t z, uint8_t moduleStart, uint8_t moduleEnd);
+  bool setZone(uint8_t z, uint16_t moduleStart, uint16_t moduleEnd);
+
+  /**
+   * Define the column limits for a zone.
+   *
+   * This is an alternative to setZone() for zones that do not start or end on a
+   * module boundary. Columns are numbered from 0 at the right hand end of the
+   * display, as defined in the MD_MAX72xx library, so a zone covering the two
+   * rightmost modules starts at column 0 and ends at column 15. All the text
+   * effects are contained within the specified columns.
+   *
+   * The display intensity and shutdown are controlled in the hardware for whole
+   * modules, so setting them for a zone will also affect other zones that share
+   * any of its modules. getZone() returns the modules that contain the zone.
+   *
+   * Zones should not overlap or unexpected results will occur.
+   *
+   * \sa setZone()
+   *
+   * \param z   zone number.
+   * \param columnStart the first display column for the zone.
+   * \param columnEnd   the last display column for the zone.
+   * \return true if set, false otherwise.
+   */
+  bool setZoneColumns(uint8_t z, uint16_t columnStart, uint16_t columnEnd);
+
+#if ENA_CANVAS
+  /**
+   * Define the display as rows of stacked modules.
+   *
+   * The modules in the display chain are divided into the specified number of rows
+   * with the same number of modules in each row. Row 0 is made from the first modules
+   * in the chain and is at the bottom of the display, with each following row stacked
+   * above it. Together the rows form a canvas that zones can span with setZoneRect().
+   *
+   * Modules that cannot be stacked directly over each other (eg, PAROLA_HW and
+   * GENERIC_HW types) are usually mounted with alternate rows rotated by 180 degrees,
+   * giving a serpentine chain. Setting flipAlternate compensates for this in the
+   * display hardware mapping, so that the canvas is always the right way up.
+   *
+   * This method is only available when the library is compiled with ENA_CANVAS set
+   * to 1 and should be called before the zones are defined.
+   *
+   * \sa setZoneRect()
+   *
+   * \param rows          the number of module rows, which must divide the number of modules.
+   * \param flipAlternate true if odd module rows are rotated by 180 degrees.
+   * \return true if set, false otherwise.
+   */
+  bool setCanvas(uint8_t rows, bool flipAlternate);
+
+  /**
+   * Define a zone as a rectangle of the canvas.
+   *
+   * The zone covers the canvas columns columnStart to columnEnd in each of the module
+   * rows rowStart to rowEnd, up to MAX_CANVAS_ROWS rows. Canvas columns are numbered
+   * from 0 at the right hand end of each row, in the same way as the display columns.
+   *
+   * All the text effects use the full height of the zone, so vertical effects like
+   * PA_SCROLL_UP, the diagonal scrolls and PA_GROW_UP move the text across all the
+   * module rows. Text from a standard single row font is centered vertically in the
+   * zone. Zones defined with setZone() or setZoneColumns() remain single row zones
+   * addressed by display chain module or column.
+   *
+   * \sa setCanvas()
+   *
+   * \param z   zone number.
+   * \param columnStart the first canvas column for the zone.
+   * \param columnEnd   the last canvas column for the zone.
+   * \param rowStart    the first (lowest) module row for the zone.
+   * \param rowEnd      the last (highest) module row for the zone.
+   * \return true if set, false otherwise.
+   */
+  bool setZoneRect(uint8_t z, uint16_t columnStart, uint16_t columnEnd, uint8_t rowStart, uint8_t rowEnd);
+#endif
 
   /** @} */
   //--------------------------------------------------------------
@@ -1584,6 +2385,16 @@ public:
    */
   inline uint16_t getSpeedOut(uint8_t z) { return (z < _numZones ? _Z[z].getSpeedOut() : 0); }
 
+  /**
+   * Get the animation timing mode for the specified zone.
+   *
+   * See the setTimingMode() method.
+   *
+   * \param z   zone number.
+   * \return the timing mode for the specified zone.
+   */
+  inline timingMode_t getTimingMode(uint8_t z) { return (z < _numZones ? _Z[z].getTimingMode() : PA_TIMING_FREE); }
+
  /**
    * Get the current text alignment specification.
    *
@@ -1787,6 +2598,40 @@ public:
    */
   inline void setSpeedInOut(uint8_t z, uint16_t speedIn, uint16_t speedOut) { if (z < _numZones) _Z[z].setSpeedInOut(speedIn, speedOut); }
 
+  /**
+   * Set the animation timing mode for all zones.
+   *
+   * By default (PA_TIMING_FREE) the next animation frame is due one frame time
+   * after the last frame actually ran, so any lateness in calling displayAnimate()
+   * slows down the animation. In the fixed time step modes frames are due at
+   * fixed intervals from the first frame of the animation and lateness does not
+   * accumulate. When frames are late PA_TIMING_CATCHUP displays each overdue frame
+   * on successive calls until it is back on time, and PA_TIMING_DROP advances
+   * through the overdue frames in one call, only displaying the last one, so
+   * the animation immediately regains its position relative to the time of day.
+   * If more than MAX_LATE_FRAMES frames are overdue the oldest are abandoned,
+   * keeping the animation on the time grid, and the last MAX_LATE_FRAMES are
+   * still run as above.
+   *
+   * Fixed time steps are useful to keep displays on separate controllers in
+   * step with each other. Frame speeds of zero always run free.
+   *
+   * \param tm the timing mode, one of the timingMode_t enumerated values.
+   * \return No return value.
+   */
+  inline void setTimingMode(timingMode_t tm) { for (uint8_t i = 0; i < _numZones; i++) _Z[i].setTimingMode(tm); }
+
+  /**
+   * Set the animation timing mode for the specified zone.
+   *
+   * See comments for the 'all zones' variant of this method.
+   *
+   * \param z   zone number.
+   * \param tm the timing mode, one of the timingMode_t enumerated values.
+   * \return No return value.
+   */
+  inline void setTimingMode(uint8_t z, timingMode_t tm) { if (z < _numZones) _Z[z].setTimingMode(tm); }
+
 #if ENA_SPRITE
   /**
   * Set data for user sprite effects (single zone).
@@ -1833,6 +2678,59 @@ public:
                      const uint8_t *outData, uint8_t outWidth, uint8_t outFrames)
   { for (uint8_t i = 0; i < _numZones; i++) _Z[i].setSpriteData(inData, inWidth, inFrames, outData, outWidth, outFrames); }
 
+#endif
+
+  /**
+  * Set the custom effect function for the specified zone.
+  *
+  * The function is called to build each animation frame when the zone entry
+  * or exit effect is PA_CUSTOM. If no function is set the PA_CUSTOM effect
+  * finishes immediately.
+  *
+  * The function is passed an effectFrame_t structure with the frame buffer to
+  * change and the message columns to display. The frame buffer is not cleared
+  * between calls. The function returns true when the effect has finished.
+  *
+  * \param z zone number.
+  * \param cb  the custom effect function, nullptr for none.
+  * \return No return value.
+  */
+  inline void setCustomEffect(uint8_t z, customEffect_t cb) { if (z < _numZones) _Z[z].setCustomEffect(cb); }
+
+  /**
+  * Set the custom effect function for all zones.
+  *
+  * See the comments for single zone variant of this method.
+  *
+  * \param cb  the custom effect function, nullptr for none.
+  * \return No return value.
+  */
+  void setCustomEffect(customEffect_t cb) { for (uint8_t i = 0; i < _numZones; i++) _Z[i].setCustomEffect(cb); }
+
+#if ENA_RANDOM
+  /**
+  * Set the PA_RANDOM effect rate for the specified zone.
+  *
+  * The PA_RANDOM effect changes the specified number of pixels in every
+  * animation frame, in a random order that visits each pixel once. The
+  * default is 1 pixel per frame. Higher rates make the effect shorter
+  * without changing the animation speed.
+  *
+  * \param z zone number.
+  * \param pixels the number of pixels changed in each animation frame.
+  * \return No return value.
+  */
+  inline void setRandomRate(uint8_t z, uint8_t pixels) { if (z < _numZones) _Z[z].setRandomRate(pixels); }
+
+  /**
+  * Set the PA_RANDOM effect rate for all zones.
+  *
+  * See the comments for single zone variant of this method.
+  *
+  * \param pixels the number of pixels changed in each animation frame.
+  * \return No return value.
+  */
+  void setRandomRate(uint8_t pixels) { for (uint8_t i = 0; i < _numZones; i++) _Z[i].setRandomRate(pixels); }
 #endif
 
   /**
@@ -1867,6 +2765,15 @@ public:
    * placed in the buffer must be properly terminated by the NUL ('\0') character or
    * processing will overrun the end of the message.
    *
+   * The text is rendered once when it is first displayed and reused for every frame
+   * of the animation, so the buffer must not be changed while an animation is running.
+   * Changes made between animations are displayed after displayReset() or
+   * setTextBuffer() is called.
+   *
+   * If a text pool was requested in begin(), the text is instead copied into the zone's
+   * part of the pool and the buffer can be reused as soon as this method returns.
+   * Changes to the buffer are then only displayed after setTextBuffer() is called again.
+   *
    * This form of the method assumes one zone only.
    *
    * \param pb  pointer to the text buffer to be used.
@@ -1885,6 +2792,78 @@ public:
    */
   inline void setTextBuffer(uint8_t z, const char *pb) { if (z < _numZones) _Z[z].setTextBuffer(pb); }
 
+  /**
+   * Set a callback function as the text source for all zones.
+   *
+   * See comments for the zone version of this method.
+   *
+   * \param cb  the callback function, nullptr to stop using it.
+   * \return No return value.
+   */
+  void setTextSource(textSource_t cb) { for (uint8_t i = 0; i < _numZones; i++) _Z[i].setTextSource(cb); }
+
+  /**
+   * Set a callback function as the text source for the specified zone.
+   *
+   * Instead of displaying a text buffer, the zone calls the textSource_t callback
+   * function each time it needs another character. The message ends when the callback
+   * returns 0. As the characters are only fetched as they are scrolled into the display,
+   * the message can be of any length and is never held in memory, making this suitable
+   * for continuous feeds of data. The next character is read one character ahead of
+   * the one being displayed.
+   *
+   * Only text scrolling in from the right can be displayed in this way, so the entry
+   * effect is always run as PA_SCROLL_LEFT and the exit effect as either PA_SCROLL_LEFT
+   * or PA_NO_EFFECT. The effects set for the zone are not changed and are used again
+   * once the zone displays a text buffer. The text alignment has no effect and the
+   * message stops scrolling when the last character has been scrolled in. The PA_FLIP_LR
+   * zone effect is not supported. Use displayReset() to start the zone after setting
+   * the callback.
+   *
+   * The last of setTextSource() and setTextBuffer() called decides where the text
+   * for the zone comes from.
+   *
+   * \param z   zone number.
+   * \param cb  the callback function, nullptr to stop using it.
+   * \return No return value.
+   */
+  inline void setTextSource(uint8_t z, textSource_t cb) { if (z < _numZones) _Z[z].setTextSource(cb); }
+
+  /**
+   * Append text to the message being displayed. Assumes one zone only.
+   *
+   * See comments for the zone version of this method.
+   *
+   * \param pText  pointer to the text to append.
+   * \return true if the text was appended, false otherwise.
+   */
+  inline bool appendText(const char *pText) { return(appendText(0, pText)); }
+
+  /**
+   * Append text to the message being displayed in the specified zone.
+   *
+   * The text is added to the end of the message while it is scrolling and flows in
+   * behind the current text, without restarting the animation. If the end of the
+   * message has already been scrolled in, the new text follows on after the normal
+   * character spacing and the message stops scrolling when the last character is in,
+   * as the text alignment no longer applies. If the zone has ended the animation, the
+   * appended text is displayed as a new message.
+   *
+   * Appending needs the text pool requested in begin(), as the text is added to the
+   * library copy of the message. Text that has already been scrolled into the display
+   * is removed from the pool to make room, so a ticker can be kept running indefinitely.
+   * The entry effect must be PA_SCROLL_LEFT and the exit effect PA_SCROLL_LEFT or
+   * PA_NO_EFFECT, as other exit effects would need the discarded text, and the
+   * PA_FLIP_LR zone effect cannot be used. Text cannot be appended to a zone using
+   * setTextSource().
+   *
+   * \param z      zone number.
+   * \param pText  pointer to the text to append.
+   * \return true if the text was appended, false if there is not enough room in the
+   * pool or the zone cannot take the text.
+   */
+  inline bool appendText(uint8_t z, const char *pText) { return(z < _numZones ? _Z[z].appendText(pText) : false); }
+
   /**
    * Set the entry and exit text effects for all zones.
    *
@@ -1911,6 +2890,39 @@ public:
    */
   inline void setTextEffect(uint8_t z, textEffect_t effectIn, textEffect_t effectOut) { if (z < _numZones) _Z[z].setTextEffect(effectIn, effectOut); }
 
+  /**
+   * Set the effect modifier for all zones.
+   *
+   * A modifier runs at the same time as the entry and exit effects, so that
+   * combinations like scrolling in while growing or wiping on while fading are
+   * possible without a new effect. The modifier builds up the display during
+   * the entry effect and takes it down during the exit effect. The entry effect
+   * is complete when both the effect and the modifier have finished, and the pause
+   * starts after that. The exit effect is complete as soon as the effect itself
+   * has finished, so the modifier is cut short by short exits and has no effect
+   * with exits that end in one frame, such as PA_PRINT and PA_NO_EFFECT.
+   *
+   * The modifier is one of the textEffect_t values PA_GROW_UP, PA_GROW_DOWN or
+   * PA_FADE, when the effect is enabled in the library. Any other value, including
+   * PA_NO_EFFECT, turns the modifier off. The modifier is applied as the frame is
+   * written to the display, so it costs no more than another pass over the frame.
+   *
+   * \param mod the modifier effect, PA_NO_EFFECT for none.
+   * \return No return value.
+   */
+  inline void setEffectModifier(textEffect_t mod) { for (uint8_t i = 0; i < _numZones; i++) _Z[i].setEffectModifier(mod); }
+
+  /**
+   * Set the effect modifier for a specific zone.
+   *
+   * See comments for the 'all zones' variant of this method.
+   *
+   * \param z   zone number.
+   * \param mod the modifier effect, PA_NO_EFFECT for none.
+   * \return No return value.
+   */
+  inline void setEffectModifier(uint8_t z, textEffect_t mod) { if (z < _numZones) _Z[z].setEffectModifier(mod); }
+
   /**
    * Set the display effect for the specified zone.
    *
@@ -2040,7 +3052,194 @@ public:
    */
   inline void setFont(uint8_t z, MD_MAX72XX::fontType_t *fontDef) { if (z < _numZones) _Z[z].setZoneFont(fontDef); }
 
+  /**
+   * Get the UTF-8 decoding setting. Assumes one zone only.
+   *
+   * \return true if the text is decoded as UTF-8.
+   */
+  inline bool getUTF8(void) { return getUTF8(0); }
+
+  /**
+   * Get the UTF-8 decoding setting for the specified zone.
+   *
+   * \param z  zone number.
+   * \return true if the text is decoded as UTF-8.
+   */
+  inline bool getUTF8(uint8_t z) { return (z < _numZones ? _Z[z].getUTF8() : false); }
+
+  /**
+   * Set UTF-8 decoding of the text for all zones.
+   *
+   * By default each byte of the text is one character code. When UTF-8 decoding is
+   * enabled, multi-byte UTF-8 sequences in the text are decoded to their Unicode code
+   * point as the text is displayed, in both directions through the text, so no
+   * conversion of the text is needed. The code point is used to look up the character,
+   * first in the user defined characters and then in the font. Code points up to 0xff
+   * match the extended ASCII (ISO 8859-1) characters in the font and other code points,
+   * such as Cyrillic or Greek characters, can be provided using addChar() or a font with
+   * more than 256 characters. Invalid sequences and code points above 0xffff are
+   * displayed as the character code UTF8_INVALID.
+   *
+   * \param b  true to decode the text as UTF-8, false for single byte characters.
+   * \return No return value.
+   */
+  void setUTF8(bool b) { for (uint8_t i = 0; i < _numZones; i++) _Z[i].setUTF8(b); }
+
+  /**
+   * Set UTF-8 decoding of the text for the specified zone.
+   *
+   * See comments for the all zones variant of this method.
+   *
+   * \param z  zone number.
+   * \param b  true to decode the text as UTF-8, false for single byte characters.
+   * \return No return value.
+   */
+  inline void setUTF8(uint8_t z, bool b) { if (z < _numZones) _Z[z].setUTF8(b); }
+
+  /** @} */
+
+#if ENA_STATS
+  //--------------------------------------------------------------
+  /** \name Support methods for performance counters.
+  * @{
+  */
+  /**
+  * Get the performance counters for a zone.
+  *
+  * Each zone counts the number of frames animated, the time taken by each frame
+  * (minimum, maximum and total), the number of frames that ran one or more frame
+  * times late, the accumulated lateness of frames (jitter) and the duration of the
+  * last complete animation cycle. The counters run from the last reset or from
+  * begin() and are only available when the library is compiled with ENA_STATS
+  * set to 1.
+  *
+  * \param z  specified zone.
+  * \param s  the structure to receive a copy of the counters.
+  * \return No return value.
+  */
+  inline void getZoneStats(uint8_t z, zoneStats_t &s) { if (z < _numZones) _Z[z].getZoneStats(s); }
+
+  /**
+  * Reset the performance counters for a zone.
+  *
+  * \param z  specified zone.
+  * \return No return value.
+  */
+  inline void resetZoneStats(uint8_t z) { if (z < _numZones) _Z[z].resetZoneStats(); }
+
   /** @} */
+#endif
+
+#if ENA_QUEUE
+  //--------------------------------------------------------------
+  /** \name Support methods for message queues.
+  * @{
+  */
+  /**
+  * Add a message to the end of the message queue. Assumes one zone only.
+  *
+  * See the queueZoneText() method for details.
+  *
+  * \param pText     parameter suitable for the setTextBuffer() method.
+  * \param align     parameter suitable for the the setTextAlignment() method.
+  * \param speed     parameter suitable for the setSpeed() method.
+  * \param pause     parameter suitable for the setPause() method.
+  * \param effectIn  parameter suitable for the setTextEffect() method.
+  * \param effectOut parameter suitable for the setTextEffect() method.
+  * \return true if the message was queued, false otherwise.
+  */
+  inline bool queueText(const char *pText, textPosition_t align, uint16_t speed, uint16_t pause, textEffect_t effectIn, textEffect_t effectOut = PA_NO_EFFECT)
+    { return(queueZoneText(0, pText, align, speed, pause, effectIn, effectOut)); }
+
+  /**
+  * Add a message to the end of the message queue for the specified zone.
+  *
+  * Each zone has a queue of up to ZONE_QUEUE_SIZE messages waiting to be displayed.
+  * When the current message in the zone has completed its animation, the oldest
+  * message in the queue is removed and started in the next call to displayAnimate(),
+  * without the application needing to check getZoneStatus() and call displayZoneText().
+  * A message queued to an idle zone is started in the same way.
+  *
+  * The text is not copied, so the text buffer must remain valid until the message
+  * has been displayed. When the queue is full the message is handled according to
+  * the policy set by setQueueOverflow().
+  *
+  * The queue is only available when the library is compiled with ENA_QUEUE set to 1.
+  *
+  * \param z         zone number.
+  * \param pText     parameter suitable for the setTextBuffer() method.
+  * \param align     parameter suitable for the the setTextAlignment() method.
+  * \param speed     parameter suitable for the setSpeed() method.
+  * \param pause     parameter suitable for the setPause() method.
+  * \param effectIn  parameter suitable for the setTextEffect() method.
+  * \param effectOut parameter suitable for the setTextEffect() method.
+  * \return true if the message was queued, false otherwise.
+  */
+  bool queueZoneText(uint8_t z, const char *pText, textPosition_t align, uint16_t speed, uint16_t pause, textEffect_t effectIn, textEffect_t effectOut = PA_NO_EFFECT);
+
+  /**
+  * Remove all the queued messages for all zones.
+  *
+  * The messages currently being displayed are not affected.
+  *
+  * \return No return value.
+  */
+  void queueClear(void) { for (uint8_t i = 0; i < _numZones; i++) _Z[i].queueClear(); }
+
+  /**
+  * Remove all the queued messages for the specified zone.
+  *
+  * The message currently being displayed is not affected.
+  *
+  * \param z  zone number.
+  * \return No return value.
+  */
+  inline void queueClear(uint8_t z) { if (z < _numZones) _Z[z].queueClear(); }
+
+  /**
+  * Get the next message in the queue for the specified zone.
+  *
+  * The parameters of the oldest queued message, which is the next one to be
+  * displayed, are copied without removing it from the queue.
+  *
+  * \param z  zone number.
+  * \param e  the structure to receive a copy of the message parameters.
+  * \return true if there is a queued message, false otherwise.
+  */
+  inline bool queuePeek(uint8_t z, queueEntry_t &e) { return(z < _numZones ? _Z[z].queuePeek(e) : false); }
+
+  /**
+  * Get the number of messages in the queue for the specified zone.
+  *
+  * \param z  zone number.
+  * \return the number of queued messages.
+  */
+  inline uint8_t getQueueCount(uint8_t z) { return(z < _numZones ? _Z[z].getQueueCount() : 0); }
+
+  /**
+  * Set the message queue overflow policy for all zones.
+  *
+  * The policy is one of the queueOverflow_t values and decides whether a message
+  * added to a full queue is rejected or replaces the oldest queued message.
+  *
+  * \param qo  one of the queueOverflow_t enumerated values.
+  * \return No return value.
+  */
+  void setQueueOverflow(queueOverflow_t qo) { for (uint8_t i = 0; i < _numZones; i++) _Z[i].setQueueOverflow(qo); }
+
+  /**
+  * Set the message queue overflow policy for the specified zone.
+  *
+  * See the comments for the all zones variant of this method.
+  *
+  * \param z   zone number.
+  * \param qo  one of the queueOverflow_t enumerated values.
+  * \return No return value.
+  */
+  inline void setQueueOverflow(uint8_t z, queueOverflow_t qo) { if (z < _numZones) _Z[z].setQueueOverflow(qo); }
+
+  /** @} */
+#endif
 
 #if ENA_GRAPHICS
   //--------------------------------------------------------------
@@ -2053,6 +3252,12 @@ public:
   * Provides a pointer to the MD_MAX72XX object to allow access to
   * the display graphics functions.
   *
+  * Each zone keeps a copy of the last frame it wrote to the display and only
+  * writes the columns that change. Changes made through this object to the
+  * columns of an animating zone may therefore stay on the display until the
+  * zone next writes those columns. Clearing, resetting or resuming a zone
+  * writes every column of the zone again.
+  *
   * \return Pointer to the MD_MAX72xx object used by the library.
   */
   inline MD_MAX72XX *getGraphicObject(void) { return(&_D); }
@@ -2150,12 +3355,13 @@ public:
   *
   * Display a non-nul terminated string given a pointer to the buffer and
   * the size of the buffer. The buffer is turned into a nul terminated string
-  * and the simple write() method is invoked. Memory is allocated and freed
-  * in this method to copy the string.
+  * and the simple write() method is invoked. If a text pool was requested in
+  * begin() the string is built in the pool for zone 0, truncated to the pool
+  * size, otherwise memory is allocated and freed in this method to copy the string.
   *
   * \param buffer Pointer to the data buffer.
   * \param size The number of bytes to write.
-  * \return the number of bytes written.
+  * \return the number of bytes written, less than size if truncated to the text pool.
   */
   virtual size_t write(const uint8_t *buffer, size_t size);
 
@@ -2169,7 +3375,17 @@ public:
 #else
   MD_PZone    *_Z;            ///< Zones buffers - dynamic zone allocation
 #endif
-  uint8_t     _numModules;///< Number of display modules [0..numModules-1]
+  uint16_t    _numModules;///< Number of display modules [0..numModules-1]
   uint8_t     _numZones;  ///< Max number of zones in the display [0..numZones-1]
+  clockSource_t _cbClock; ///< Clock source for animation timing, millis() when nullptr
+  char        *_textPool; ///< Text pool for all zones, nullptr if not used
+  uint16_t    _textPoolSize;  ///< Size of the text pool for each zone
+#if ENA_CANVAS
+  uint8_t     _canvasRows;  ///< Number of stacked rows of modules
+  bool        _canvasFlip;  ///< Odd rows of modules are rotated 180 degrees
+#endif
+
+  uint32_t clockNow(void) { return(_cbClock == nullptr ? millis() : _cbClock()); }  ///< Current animation time
+  bool animateZones(uint32_t now);  ///< Animate all the zones at the time now
 };
 
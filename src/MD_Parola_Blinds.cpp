@@ -47,10 +47,10 @@ void MD_PZone::effectBlinds(bool bIn)
     PRINT_STATE("IO BLIND");
 
     _nextPos++;
-    for (int16_t i = ZONE_START_COL(_zoneStart); i <= ZONE_END_COL(_zoneEnd); i++)
+    for (int16_t i = _colStart; i <= _colEnd; i++)
     {
       if (i % BLINDS_SIZE < _nextPos)
-        _MX->setColumn(i, LIGHT_BAR);
+        setFrameColumn(i, LIGHT_BAR);
     }
 
     if (_nextPos == BLINDS_SIZE)
@@ -62,14 +62,14 @@ void MD_PZone::effectBlinds(bool bIn)
 
   case GET_NEXT_CHAR:   // blinds opening
     PRINT_STATE("IO BLIND");
-    zoneClear();
+    clearFrame();
     if (bIn) commonPrint(); // only do this when putting the message up
 
     _nextPos--;
-    for (int16_t i = ZONE_START_COL(_zoneStart); i <= ZONE_END_COL(_zoneEnd); i++)
+    for (int16_t i = _colStart; i <= _colEnd; i++)
     {
       if (i % BLINDS_SIZE < _nextPos)
-        _MX->setColumn(i, LIGHT_BAR);
+        setFrameColumn(i, LIGHT_BAR);
     }
 
     if (_nextPos == 0)
@@ -78,7 +78,7 @@ void MD_PZone::effectBlinds(bool bIn)
 
   case PUT_CHAR:
     PRINT_STATE("IO BLIND");
-    zoneClear();
+    clearFrame();
     if (bIn) commonPrint();
     _fsmState = (bIn ? PAUSE : END);
     break;
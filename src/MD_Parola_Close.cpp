@@ -41,11 +41,11 @@ void MD_PZone::effectClose(bool bLightBar, bool bIn)
     case GET_NEXT_CHAR:
       PRINT_STATE("I CLOSE");
       _nextPos = 0;
-      zoneClear();
+      clearFrame();
       if (bLightBar)
       {
-        _MX->setColumn(_limitLeft, LIGHT_BAR);
-        _MX->setColumn(_limitRight,LIGHT_BAR);
+        setFrameColumn(_limitLeft, LIGHT_BAR);
+        setFrameColumn(_limitRight,LIGHT_BAR);
       }
       _fsmState = PUT_CHAR;
       // fall through
@@ -53,7 +53,7 @@ void MD_PZone::effectClose(bool bLightBar, bool bIn)
     case PUT_CHAR:
       PRINT_STATE("I CLOSE");
       FSMPRINT(" - offset ", _nextPos);
-      zoneClear();
+      clearFrame();
       commonPrint();
       {
         const int16_t halfWidth = (_limitLeft - _limitRight) / 2;
@@ -65,13 +65,13 @@ void MD_PZone::effectClose(bool bLightBar, bool bIn)
         else
         {
           for (int16_t i = _limitRight + _nextPos + 1; i < _limitLeft - _nextPos; i++)
-            _MX->setColumn(i, EMPTY_BAR);
+            setFrameColumn(i, EMPTY_BAR);
 
           _nextPos++;
           if (bLightBar && (_nextPos <= halfWidth))
           {
-            _MX->setColumn(_limitLeft - _nextPos, LIGHT_BAR);
-            _MX->setColumn(_limitRight + _nextPos, LIGHT_BAR);
+            setFrameColumn(_limitLeft - _nextPos, LIGHT_BAR);
+            setFrameColumn(_limitRight + _nextPos, LIGHT_BAR);
           }
         }
       }
@@ -95,12 +95,12 @@ void MD_PZone::effectClose(bool bLightBar, bool bIn)
       FSMPRINT(" L:", _limitLeft);
       _nextPos = (_limitLeft - _limitRight) / 2;
       FSMPRINT(" O:", _nextPos);
-      zoneClear();
+      clearFrame();
       commonPrint();
       if (bLightBar)
       {
-        _MX->setColumn(_limitLeft - _nextPos, LIGHT_BAR);
-        _MX->setColumn(_limitRight + _nextPos, LIGHT_BAR);
+        setFrameColumn(_limitLeft - _nextPos, LIGHT_BAR);
+        setFrameColumn(_limitRight + _nextPos, LIGHT_BAR);
       }
       _fsmState = PUT_CHAR;
       break;
@@ -114,14 +114,14 @@ void MD_PZone::effectClose(bool bLightBar, bool bIn)
       }
       else
       {
-        _MX->setColumn(_limitLeft - _nextPos, EMPTY_BAR);
-        _MX->setColumn(_limitRight + _nextPos, EMPTY_BAR);
+        setFrameColumn(_limitLeft - _nextPos, EMPTY_BAR);
+        setFrameColumn(_limitRight + _nextPos, EMPTY_BAR);
 
         _nextPos--;
         if (bLightBar && (_nextPos >= 0))
         {
-          _MX->setColumn(_limitLeft - _nextPos, LIGHT_BAR);
-          _MX->setColumn(_limitRight + _nextPos, LIGHT_BAR);
+          setFrameColumn(_limitLeft - _nextPos, LIGHT_BAR);
+          setFrameColumn(_limitRight + _nextPos, LIGHT_BAR);
         }
       }
       break;
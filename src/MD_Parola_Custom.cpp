@@ -0,0 +1,81 @@
+/*
+MD_Parola - Library for modular scrolling text and Effects
+
+See header file for comments
+
+Copyright (C) 2013 Marco Colli. All rights reserved.
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <MD_Parola.h>
+#include <MD_Parola_lib.h>
+/**
+ * \file
+ * \brief Implements custom effect
+ */
+
+void MD_PZone::effectCustom(bool bIn)
+// Run the user effect function for one frame.
+// The function works directly on the frame buffer and the text cache, and
+// _nextPos counts the frames since the start of the entry or exit effect.
+{
+  if (_cbEffect == nullptr)
+  {
+    _fsmState = (bIn ? PAUSE : END);
+    return;
+  }
+
+  switch (_fsmState)
+  {
+  case INITIALISE:    // Entry bIn == true
+  case PAUSE:         // Exit  bIn == false
+    PRINT_STATE("IO CUSTOM");
+    _nextPos = 0;
+    _fsmState = PUT_CHAR;
+    // fall through to next state
+
+  case GET_FIRST_CHAR:
+  case GET_NEXT_CHAR:
+  case PUT_CHAR:
+    PRINT_STATE("IO CUSTOM");
+    {
+      effectFrame_t f;
+
+      if (!_tCacheValid || _tCacheReversed != isTextReversed())
+        cacheText();
+
+      f.frame = _frame;
+      f.frameSize = _frameSize;
+      f.height = COL_BITS;
+      f.text = (_tCacheValid ? _tCache : nullptr);
+      f.textSize = (_tCacheValid ? _limitLeft - _limitRight + 1 : 0);
+      f.textPos = _limitLeft - _colStart;
+      f.frameNum = _nextPos;
+      f.bIn = bIn;
+      f.inverted = _inverted;
+
+      if (_cbEffect(&f))
+        _fsmState = (bIn ? PAUSE : END);
+    }
+
+    _nextPos++; // for the next time around
+    break;
+
+  default:
+    PRINT_STATE("IO CUSTOM");
+    _fsmState = (bIn ? PAUSE : END);
+  }
+}
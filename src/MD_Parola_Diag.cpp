@@ -38,8 +38,7 @@ void MD_PZone::effectDiag(bool bUp, bool bLeft, bool bIn)
     {
     case INITIALISE:
       PRINT_STATE("I DIAG");
-      _nextPos = COL_SIZE - 1;   // the position in the animation
-      _MX->control(_zoneStart, _zoneEnd, MD_MAX72XX::WRAPAROUND, MD_MAX72XX::OFF);
+      _nextPos = COL_BITS - 1;   // the position in the animation
       _fsmState = PUT_CHAR;
       // fall through to next state
 
@@ -49,43 +48,14 @@ void MD_PZone::effectDiag(bool bUp, bool bLeft, bool bIn)
     case PAUSE:
       PRINT_STATE("I DIAG");
 
-      zoneClear();
+      clearFrame();
       commonPrint();
 
       // scroll each column of the display so that the message appears to be animated
       // Note: Directions are reversed here because we start with the message in the
       // middle position thru commonPrint() and to see it animated moving DOWN we
       // need to scroll it UP, and vice versa.
-      if (bLeft)
-      {
-        for (int16_t j = _nextPos; j <= ZONE_END_COL(_zoneEnd); j++)   // for each column
-        {
-          uint8_t c = _MX->getColumn(j);
-
-          for (int8_t i = _nextPos; i > 0; i--)
-          {
-            c = (bUp ? c << 1 : c >> 1);
-            if (_inverted) c |= (bUp ? 0x01 : 0x80);
-          }
-
-          _MX->setColumn(j - _nextPos, c);
-        }
-      }
-      else  // going right
-      {
-        for (int16_t j = ZONE_END_COL(_zoneEnd) - _nextPos + 1; j >= ZONE_START_COL(_zoneStart); j--)   // for each column
-        {
-          uint8_t c = _MX->getColumn(j);
-
-          for (int8_t i = _nextPos; i > 0; i--)
-          {
-            c = (bUp ? c << 1 : c >> 1);
-            if (_inverted) c |= (bUp ? 0x01 : 0x80);
-          }
-
-          _MX->setColumn(j + _nextPos, c);
-        }
-      }
+      shiftFrameBits(!bUp, _nextPos, bLeft ? -_nextPos : _nextPos);
 
       // check if we have finished
       if (_nextPos == 0) _fsmState = PAUSE;
@@ -114,33 +84,10 @@ void MD_PZone::effectDiag(bool bUp, bool bLeft, bool bIn)
     case PUT_CHAR:
       PRINT_STATE("O DIAG");
 
-      if (bLeft)
-      {
-        for (int16_t j = ZONE_END_COL(_zoneEnd) - 1; j >= ZONE_START_COL(_zoneStart); j--)   // for each column
-        {
-          uint8_t c = _MX->getColumn(j);
-
-          c = (bUp ? c >> 1 : c << 1);
-          if (_inverted) c |= (bUp ? 0x80 : 0x01);
-
-          _MX->setColumn(j + 1, c);
-        }
-      }
-      else    // going right
-      {
-        for (int16_t j = ZONE_START_COL(_zoneStart) + 1; j <= ZONE_END_COL(_zoneEnd); j++)   // for each column
-        {
-          uint8_t c = _MX->getColumn(j);
-
-          c = (bUp ? c >> 1 : c << 1);
-          if (_inverted) c |= (bUp ? 0x80 : 0x01);
-
-          _MX->setColumn(j - 1, c);
-        }
-      }
-     _MX->setColumn((bLeft ? ZONE_START_COL(_zoneStart) : ZONE_END_COL(_zoneEnd)), EMPTY_BAR);  // fill in the end
+      shiftFrameBits(bUp, 1, bLeft ? 1 : -1);
+     setFrameColumn((bLeft ? _colStart : _colEnd), EMPTY_BAR);  // fill in the end
       // check if we have finished
-      if (_nextPos == COL_SIZE - 1) _fsmState = END;
+      if (_nextPos == COL_BITS - 1) _fsmState = END;
 
       _nextPos++;
       break;
@@ -38,33 +38,33 @@ void MD_PZone::effectDissolve(bool bIn)
   case PAUSE:   // bIn = false
   case GET_FIRST_CHAR:  // first stage dissolve
     PRINT_STATE("IO DISS");
-    for (int16_t i = ZONE_START_COL(_zoneStart); i <= ZONE_END_COL(_zoneEnd); i++)
+    for (int16_t i = _colStart; i <= _colEnd; i++)
     {
-      uint8_t col = DATA_BAR(_MX->getColumn(i));
+      colData_t col = DATA_BAR(getFrameColumn(i));
 
-      col |= (i&1 ? 0x55 : 0xaa); // checkerboard pattern
-      _MX->setColumn(i, DATA_BAR(col));
+      col |= (colData_t)(i&1 ? 0x55555555 : 0xaaaaaaaa); // checkerboard pattern
+      setFrameColumn(i, DATA_BAR(col));
     }
     _fsmState = GET_NEXT_CHAR;
     break;
 
   case GET_NEXT_CHAR:   // second stage dissolve
     PRINT_STATE("IO DISS");
-    zoneClear();
+    clearFrame();
     if (bIn) commonPrint();
-    for (int16_t i = ZONE_START_COL(_zoneStart); i <= ZONE_END_COL(_zoneEnd); i++)
+    for (int16_t i = _colStart; i <= _colEnd; i++)
     {
-      uint8_t col = DATA_BAR(_MX->getColumn(i));
+      colData_t col = DATA_BAR(getFrameColumn(i));
 
-      col |= (i&1 ? 0xaa : 0x55); // alternate checkerboard pattern
-      _MX->setColumn(i, DATA_BAR(col));
+      col |= (colData_t)(i&1 ? 0xaaaaaaaa : 0x55555555); // alternate checkerboard pattern
+      setFrameColumn(i, DATA_BAR(col));
     }
     _fsmState = PUT_CHAR;
     break;
 
   case PUT_CHAR:
     PRINT_STATE("IO DISS");
-    zoneClear();
+    clearFrame();
     if (bIn) commonPrint();
     _fsmState = (bIn ? PAUSE : END);
     break;
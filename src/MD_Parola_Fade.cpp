@@ -44,7 +44,7 @@ void MD_PZone::effectFade(bool bIn)
       _nextPos = 0;
       _endPos = getIntensity();
 
-      zoneClear();
+      clearFrame();
 
       _fsmState = GET_FIRST_CHAR;
       break;
@@ -107,7 +107,7 @@ void MD_PZone::effectFade(bool bIn)
       if (_nextPos < 0)
       {
         setIntensity(_endPos);  // set to original conditions
-        zoneClear();            // display nothing - we are currently at 0
+        clearFrame();            // display nothing - we are currently at 0
         _fsmState = END;
       }
       else
@@ -31,9 +31,12 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
 
 void MD_PZone::effectGrow(bool bUp, bool bIn)
 // Scan the message over with a new one
-// Print up the whole message and then remove the parts we
-// don't need in order to do the animation.
+// Print only the parts of the message we need in order to do the animation.
+// _nextPos counts the animation steps and the mask of bits for each step is
+// calculated from it.
 {
+  colData_t mask;
+
   if (bIn)  // incoming
   {
     switch (_fsmState)
@@ -41,7 +44,7 @@ void MD_PZone::effectGrow(bool bUp, bool bIn)
     case INITIALISE:
       PRINT_STATE("I GROW");
       setInitialEffectConditions();
-      _nextPos = (bUp ? 0xff : 1); // this is the bit mask
+      _nextPos = 0;
       _fsmState = PUT_CHAR;
       // fall through to next state
 
@@ -51,28 +54,20 @@ void MD_PZone::effectGrow(bool bUp, bool bIn)
     case PAUSE:
       PRINT_STATE("I GROW");
 
-      commonPrint();
       // check if we have finished
-      if (_nextPos == (bUp ? 0 : 0xff)) // all bits covered
+      if (_nextPos == (bUp ? COL_BITS : COL_BITS - 1)) // all bits covered
       {
+        commonPrint();
         _fsmState = PAUSE;
         break;
       }
 
-      // blank out the part of the display we don't need
-      FSMPRINT("Keep bits ", _nextPos);
-      for (int16_t i = _startPos; i != _endPos + _posOffset; i += _posOffset)
-      {
-        uint8_t c = DATA_BAR(_MX->getColumn(i)) & (bUp ? ~_nextPos : _nextPos);
-
-        _MX->setColumn(i, DATA_BAR(c));
-      }
+      // print only the part of the display we need
+      mask = COL_MASK >> (bUp ? _nextPos : COL_BITS - 1 - _nextPos);
+      FSMPRINT("Keep bits ", mask);
+      commonPrint(bUp ? ~mask : mask);
 
-      // for the next time around
-      if (bUp)
-        _nextPos >>= 1;
-      else
-        _nextPos = (_nextPos << 1) | 1;
+      _nextPos++; // for the next time around
       break;
 
     default:
@@ -88,7 +83,7 @@ void MD_PZone::effectGrow(bool bUp, bool bIn)
     case INITIALISE:
       PRINT_STATE("O GROW");
       setInitialEffectConditions();
-      _nextPos = (bUp ? 1 : 0xff);  // this is the bit mask
+      _nextPos = 0;
       _fsmState = PUT_CHAR;
       // fall through to next state
 
@@ -96,26 +91,20 @@ void MD_PZone::effectGrow(bool bUp, bool bIn)
     case GET_NEXT_CHAR:
     case PUT_CHAR:
       PRINT_STATE("O GROW");
-      commonPrint();
 
-      // blank out the part of the display we don't need
-      FSMPRINT(" Keep bits ", _nextPos);
-      for (int16_t i =_startPos; i != _endPos + _posOffset; i += _posOffset)
-      {
-        uint8_t c = DATA_BAR(_MX->getColumn(i)) & (bUp ? ~_nextPos : _nextPos);
-
-        _MX->setColumn(i, DATA_BAR(c));
-      }
+      // print only the part of the display we need
+      if (bUp)
+        mask = COL_MASK >> (COL_BITS - 1 - _nextPos);
+      else
+        mask = (_nextPos == COL_BITS ? 0 : COL_MASK >> _nextPos);
+      FSMPRINT(" Keep bits ", mask);
+      commonPrint(bUp ? ~mask : mask);
 
       // check if we have finished
-      if (_nextPos == (bUp ? 0xff : 0x0)) // all bits covered
+      if (_nextPos == (bUp ? COL_BITS - 1 : COL_BITS)) // all bits covered
         _fsmState = END;
 
-      // for the next time around
-      if (bUp)
-        _nextPos = (_nextPos << 1) | 1;
-      else
-        _nextPos >>= 1;
+      _nextPos++; // for the next time around
       break;
 
     default:
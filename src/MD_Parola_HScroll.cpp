@@ -27,7 +27,7 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
  * \brief Implements horizontal scrolling effect
  */
 
-#define START_POSITION (bLeft) ? ZONE_START_COL(_zoneStart) : ZONE_END_COL(_zoneEnd) ///< Start position depends on the scrolling direction
+#define START_POSITION (bLeft) ? _colStart : _colEnd ///< Start position depends on the scrolling direction
 
 void MD_PZone::effectHScroll(bool bLeft, bool bIn)
 {
@@ -70,8 +70,8 @@ void MD_PZone::effectHScroll(bool bLeft, bool bIn)
 
       if (_charCols != 0)
       {
-        _MX->transform(_zoneStart, _zoneEnd, bLeft ? MD_MAX72XX::TSL : MD_MAX72XX::TSR);
-        _MX->setColumn(START_POSITION, DATA_BAR(_cBuf[_countCols++]));
+        shiftFrame(bLeft);
+        setFrameColumn(START_POSITION, DATA_BAR(_cBuf[_countCols++]));
         FSMPRINTS(", scroll");
       }
 
@@ -83,7 +83,7 @@ void MD_PZone::effectHScroll(bool bLeft, bool bIn)
         else
         {
           // work out the number of filler columns
-          _countCols = (bLeft ? _limitLeft - _textLen - ZONE_START_COL(_zoneStart) + 1 : ZONE_END_COL(_zoneEnd) - _limitLeft);
+          _countCols = (bLeft ? _limitLeft - _textLen - _colStart + 1 : _colEnd - _limitLeft);
           FSMPRINT(", filler count ", _countCols);
           _fsmState = (_countCols <= 0) ? PAUSE : PUT_FILLER;
         }
@@ -93,12 +93,13 @@ void MD_PZone::effectHScroll(bool bLeft, bool bIn)
     case PUT_FILLER:    // keep sending out blank columns until aligned
       PRINT_STATE("I HSCROLL");
 
-      _MX->transform(_zoneStart, _zoneEnd, bLeft ? MD_MAX72XX::TSL : MD_MAX72XX::TSR);
-      _MX->setColumn(START_POSITION, EMPTY_BAR);
+      shiftFrame(bLeft);
+      setFrameColumn(START_POSITION, EMPTY_BAR);
       FSMPRINTS(", fill");
 
+      // more text may have been appended while the filler was shown
       if (--_countCols == 0)
-        _fsmState = PAUSE;
+        _fsmState = (_endOfText ? PAUSE : GET_NEXT_CHAR);
     break;
 
     default:
@@ -118,27 +119,27 @@ void MD_PZone::effectHScroll(bool bLeft, bool bIn)
 
     case PUT_FILLER:
       PRINT_STATE("O HSCROLL");
-      _MX->transform(_zoneStart, _zoneEnd, bLeft ? MD_MAX72XX::TSL : MD_MAX72XX::TSR);
-      _MX->setColumn(START_POSITION, EMPTY_BAR);
+      shiftFrame(bLeft);
+      setFrameColumn(START_POSITION, EMPTY_BAR);
 
       // check if enough scrolled off to say that new message should start
       // how we count depends on the direction for scrolling
       {
         uint16_t  spaceCount = 0;
-        uint16_t  maxCount = (_zoneEnd - _zoneStart + 1) * COL_SIZE;
+        uint16_t  maxCount = _colEnd - _colStart + 1;
 
         if ((_scrollDistance != 0) && (maxCount > _scrollDistance)) maxCount = _scrollDistance;
 
         if (bLeft)
         {
-          for (int16_t i = ZONE_START_COL(_zoneStart);
-              (i <= ZONE_END_COL(_zoneEnd)) && (_MX->getColumn(i) == EMPTY_BAR);
+          for (int16_t i = _colStart;
+              (i <= _colEnd) && (getFrameColumn(i) == EMPTY_BAR);
                i++, spaceCount++);
         }
         else
         {
-          for (int16_t i = ZONE_END_COL(_zoneEnd);
-              (i >= ZONE_START_COL(_zoneStart)) && (_MX->getColumn(i) == EMPTY_BAR);
+          for (int16_t i = _colEnd;
+              (i >= _colStart) && (getFrameColumn(i) == EMPTY_BAR);
               i--, spaceCount++);
         }
 
@@ -50,25 +50,22 @@ void MD_PZone::effectMesh(bool bIn)
     case PAUSE:
       PRINT_STATE("I MESH");
 
-      zoneClear();
+      clearFrame();
       commonPrint();
 
-      for (uint8_t c = ZONE_START_COL(_zoneStart); c <= ZONE_END_COL(_zoneEnd); c++)
+      // scroll the whole display so that the message appears to be animated
+      // Note: Directions are reversed because we start with the message in the
+      // middle position thru commonPrint() and to see it animated move DOWN we
+      // need to scroll it UP, and vice versa.
+      for (uint16_t i = 0; i < _frameSize; i++)
       {
-        // scroll the whole display so that the message appears to be animated
-        // Note: Directions are reversed because we start with the message in the
-        // middle position thru commonPrint() and to see it animated move DOWN we
-        // need to scroll it UP, and vice versa.
-        uint8_t col = _MX->getColumn(c);
-
-        col = (bUp ? col >> (COL_SIZE - 1 - _nextPos) : col << (COL_SIZE - 1 - _nextPos));
-        _MX->setColumn(c, col);
+        _frame[i] = (bUp ? _frame[i] >> (COL_BITS - 1 - _nextPos) : (_frame[i] << (COL_BITS - 1 - _nextPos)) & COL_MASK);
         bUp = !bUp;
       }
 
       // check if we have finished
       _nextPos++;
-      if (_nextPos == COL_SIZE) _fsmState = PAUSE;
+      if (_nextPos == COL_BITS) _fsmState = PAUSE;
       break;
 
     default:
@@ -92,18 +89,15 @@ void MD_PZone::effectMesh(bool bIn)
     case PUT_CHAR:
       PRINT_STATE("O MESH");
 
-      for (uint8_t c = ZONE_START_COL(_zoneStart); c <= ZONE_END_COL(_zoneEnd); c++)
+      for (uint16_t i = 0; i < _frameSize; i++)
       {
-        uint8_t col = _MX->getColumn(c);
-
-        col = (bUp ? col << _nextPos : col >> _nextPos);
-        _MX->setColumn(c, col);
+        _frame[i] = (bUp ? (_frame[i] << _nextPos) & COL_MASK : _frame[i] >> _nextPos);
         bUp = !bUp;
       }
 
       // check if we have finished
       _nextPos++;
-      if (_nextPos == COL_SIZE) _fsmState = END;
+      if (_nextPos == COL_BITS) _fsmState = END;
       break;
 
     default:
@@ -46,8 +46,8 @@ void MD_PZone::effectOpen(bool bLightBar, bool bIn)
       FSMPRINT(" O:", _nextPos);
       if (bLightBar)
       {
-        _MX->setColumn(_limitLeft - _nextPos, LIGHT_BAR);
-        _MX->setColumn(_limitRight + _nextPos, LIGHT_BAR);
+        setFrameColumn(_limitLeft - _nextPos, LIGHT_BAR);
+        setFrameColumn(_limitRight + _nextPos, LIGHT_BAR);
       }
       _fsmState = PUT_CHAR;
       break;
@@ -64,15 +64,15 @@ void MD_PZone::effectOpen(bool bLightBar, bool bIn)
         commonPrint();
         for (int16_t i = 0; i < _nextPos; i++)
         {
-          _MX->setColumn(_limitRight + i, EMPTY_BAR);
-          _MX->setColumn(_limitLeft - i, EMPTY_BAR);
+          setFrameColumn(_limitRight + i, EMPTY_BAR);
+          setFrameColumn(_limitLeft - i, EMPTY_BAR);
         }
 
         _nextPos--;
         if (bLightBar && (_nextPos >= 0))
         {
-          _MX->setColumn(_limitRight + _nextPos, LIGHT_BAR);
-          _MX->setColumn(_limitLeft - _nextPos, LIGHT_BAR);
+          setFrameColumn(_limitRight + _nextPos, LIGHT_BAR);
+          setFrameColumn(_limitLeft - _nextPos, LIGHT_BAR);
         }
       }
       break;
@@ -90,13 +90,13 @@ void MD_PZone::effectOpen(bool bLightBar, bool bIn)
     case GET_FIRST_CHAR:
     case GET_NEXT_CHAR:
       PRINT_STATE("O OPEN");
-      zoneClear();
+      clearFrame();
       commonPrint();
       _nextPos = 0;
       if (bLightBar)
       {
-        _MX->setColumn(_limitLeft, LIGHT_BAR);
-        _MX->setColumn(_limitRight,LIGHT_BAR);
+        setFrameColumn(_limitLeft, LIGHT_BAR);
+        setFrameColumn(_limitRight,LIGHT_BAR);
       }
       _fsmState = PUT_CHAR;
       // fall through
@@ -110,13 +110,13 @@ void MD_PZone::effectOpen(bool bLightBar, bool bIn)
       }
       else
       {
-        _MX->setColumn(_limitLeft - _nextPos, EMPTY_BAR);
-        _MX->setColumn(_limitRight + _nextPos, EMPTY_BAR);
+        setFrameColumn(_limitLeft - _nextPos, EMPTY_BAR);
+        setFrameColumn(_limitRight + _nextPos, EMPTY_BAR);
         _nextPos++;
         if (bLightBar && (_nextPos <= (_limitLeft - _limitRight) / 2))
         {
-          _MX->setColumn(_limitLeft - _nextPos, LIGHT_BAR);
-          _MX->setColumn(_limitRight + _nextPos,LIGHT_BAR);
+          setFrameColumn(_limitLeft - _nextPos, LIGHT_BAR);
+          setFrameColumn(_limitRight + _nextPos,LIGHT_BAR);
         }
       }
       break;
@@ -27,30 +27,42 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
  * \brief Implements static print effect
  */
 
-void MD_PZone::commonPrint(void)
+void MD_PZone::commonPrint(colData_t keep)
+// Print the text using the columns pre-rendered in the text cache.
+// Only the LEDs in the keep mask are printed, so effects that mask the
+// text do it in the same pass. Text that cannot be cached is rendered
+// column by column on every call.
 {
-  int16_t nextPos;
-
   PRINTS("\ncommonPrint");
-  zoneClear();
-  nextPos = _limitLeft;
-  getFirstChar(_charCols);
-  _countCols = 0;
+  clearFrame();
+
+  if (!_tCacheValid || _tCacheReversed != isTextReversed())
+    cacheText();
 
-  while (nextPos >= _limitRight)
+  if (!_tCacheValid)
   {
-    PRINT("\nCountCol=", _countCols);
-    PRINT(" CharCol=", _charCols);
-    if (_countCols == _charCols || _charCols == 0)
+    int16_t nextPos = _limitLeft;
+
+    getFirstChar(_charCols);
+    _countCols = 0;
+
+    while (nextPos >= _limitRight)
     {
-      getNextChar(_charCols);
-      _countCols = 0;
-    }
+      if (_countCols == _charCols || _charCols == 0)
+      {
+        if (!getNextChar(_charCols))
+          break;    // ran out of text, the rest of the frame stays blank
+        _countCols = 0;
+      }
 
-    // now put something on the display
-    if (_charCols != 0)
-      _MX->setColumn(nextPos--, DATA_BAR(_cBuf[_countCols++]));
+      if (_charCols != 0)
+        setFrameColumn(nextPos--, DATA_BAR((_cBuf[_countCols++] & keep)));
+    }
+    return;
   }
+
+  for (int16_t i = 0; i <= _limitLeft - _limitRight; i++)
+    setFrameColumn(_limitLeft - i, DATA_BAR((_tCache[i] & keep)));
 }
 
 void MD_PZone::effectPrint(bool bIn)
@@ -63,7 +75,7 @@ void MD_PZone::effectPrint(bool bIn)
   }
   else  //exiting
   {
-    zoneClear();
+    clearFrame();
     _fsmState = END;
   }
 }
@@ -27,23 +27,36 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
  * \brief Implements random effect
  */
 
-#if ENA_MISC
+#if ENA_RANDOM
 
-#define RAND_CYCLE 11  // random effect repeats every RANDOM_CYCLE columns
+// Galois LFSR feedback masks for maximal length sequences of 7, 8 and 9 bits
+static const uint16_t PROGMEM lfsrTaps[] = { 0x60, 0xb8, 0x110 };
+#define LFSR_MIN_BITS 7   // register size for the first entry in lfsrTaps[]
 
 void MD_PZone::effectRandom(bool bIn)
 // Text enters as random dots
+// The dots are revealed in the order of a maximal length LFSR sequence that is
+// at least as long as the number of pixels in the mask. Values past the end of
+// the mask are skipped, so every pixel is revealed exactly once and each frame
+// takes the same time however full the mask is.
 {
-  static uint8_t pix[RAND_CYCLE];  // pixel data (one byte per column) to mask the display
-  uint8_t c, r;   // the row and column coordinates being considered
+  uint16_t pixels = RAND_CYCLE * COL_BITS;  // number of pixels in the mask
+  uint8_t k = 0;
 
-switch (_fsmState)
-{
+  uint16_t taps;
+
+  while (((1 << (LFSR_MIN_BITS + k)) - 1) < pixels)
+    k++;
+  taps = pgm_read_word(&lfsrTaps[k]);
+
+  switch (_fsmState)
+  {
   case INITIALISE:    // Entry bIn == true
   case PAUSE:         // Exit  bIn == false
     PRINT_STATE("IO RAND");
-    for (uint8_t i = 0; i < RAND_CYCLE; i++)
-      pix[i] = 0;
+    memset(randMask(), 0, RAND_CYCLE * sizeof(colData_t));
+    _randState = random(1, 1 << (LFSR_MIN_BITS + k));   // any non zero start
+    _randCount = pixels;
 
     _fsmState = PUT_CHAR;
     // fall through to next state
@@ -54,19 +67,20 @@ switch (_fsmState)
     PRINT_STATE("IO RAND");
     if (bIn) FSMPRINTS(" in"); else FSMPRINTS(" out");
 
-    // Work out and set the next random pixel in the column mask.
-    // Use a loop counter to make sure we just don't loop forever.
-    _nextPos = 0;
-    do
+    // Set the next pixels in the column mask, skipping the LFSR values past the end of the mask
+    for (uint8_t i = 0; i < _randRate && _randCount != 0; i++)
     {
-      c = random(RAND_CYCLE);
-      r = random(ROW_SIZE);
-      _nextPos++;
-    } while (pix[c] & (1 << r) && _nextPos < 5000);
+      uint16_t p;
 
-    // FSMPRINT("\n [r,c]=", r); FSMPRINT(",", c); FSMPRINT(" counter ", _nextPos);
+      do
+      {
+        p = _randState - 1;
+        _randState = (_randState >> 1) ^ ((_randState & 1) ? taps : 0);
+      } while (p >= pixels);
 
-    pix[c] |= (1 << r); // set the r,c location in the mask
+      randMask()[p / COL_BITS] |= ((colData_t)1 << (p % COL_BITS)); // set the r,c location in the mask
+      _randCount--;
+    }
 
     // set up a new display
     commonPrint();
@@ -74,27 +88,17 @@ switch (_fsmState)
     // now mask each column by the pixel mask - this repeats every RAND_CYCLE columns, but the
     // characters don't occupy every pixel so the effect looks 'random' across the whole display.
     _nextPos = 0;
-    for (uint8_t c = ZONE_START_COL(_zoneStart); c <= ZONE_END_COL(_zoneEnd); c++)
+    for (uint16_t i = 0; i < _frameSize; i++)
     {
-      uint8_t col = _MX->getColumn(c);
-
-      col &= (bIn ? pix[_nextPos] : ~pix[_nextPos]);  // set or reset the bit (depends on bIn)
-      _MX->setColumn(c, col);
+      _frame[i] &= (bIn ? randMask()[_nextPos] : ~randMask()[_nextPos]);  // set or reset the bit (depends on bIn)
 
       _nextPos++;
       if (_nextPos == RAND_CYCLE)
         _nextPos = 0;
     }
 
-    // check if we have finished. This is when all the columns have pixels all on (0xff)
-    {
-      bool bEnd = true;
-
-      for (uint8_t i = 0; bEnd && i < COL_SIZE; i++)
-        bEnd = (pix[i] == 0xff);
-
-      if (bEnd) _fsmState = (bIn ? PAUSE : END);
-      }
+    // check if we have finished. This is when all the pixels in the mask are set
+    if (_randCount == 0) _fsmState = (bIn ? PAUSE : END);
     break;
 
   default:
@@ -103,4 +107,4 @@ switch (_fsmState)
   }
 }
 
-#endif
\ No newline at end of file
+#endif
@@ -64,7 +64,7 @@ void MD_PZone::effectHScan(bool bIn, bool bBlank)
       for (int16_t i = _startPos; i != _endPos + _posOffset; i += _posOffset)
       {
         if ((!bBlank && (i != _nextPos)) || (bBlank && (i == _nextPos)))
-          _MX->setColumn(i, EMPTY_BAR);
+          setFrameColumn(i, EMPTY_BAR);
       }
 
       _nextPos += _posOffset; // for the next time around
@@ -97,7 +97,7 @@ void MD_PZone::effectHScan(bool bIn, bool bBlank)
       for (int16_t i = _startPos; i != _endPos + _posOffset; i += _posOffset)
       {
         if ((!bBlank && (i != _nextPos)) || (bBlank && (i == _nextPos)))
-          _MX->setColumn(i, EMPTY_BAR);
+          setFrameColumn(i, EMPTY_BAR);
       }
 
       // check if we have finished
@@ -117,10 +117,9 @@ void MD_PZone::effectHScan(bool bIn, bool bBlank)
 void MD_PZone::effectVScan(bool bIn, bool bBlank)
 // Scan the message over with a new one
 // if bBlank is true, a blank column scans the text. If false, a non-blank scans the text.
-// Print up the whole message and then remove the parts we
-// don't need in order to do the animation.
+// Print only the parts of the message we need in order to do the animation.
 {
-  uint8_t maskCol = 0;
+  colData_t maskCol = 0;
 
   if (bIn)  // incoming
   {
@@ -138,24 +137,19 @@ void MD_PZone::effectVScan(bool bIn, bool bBlank)
     case PUT_CHAR:
     case PAUSE:
       PRINT_STATE("I SCANV");
-      commonPrint();
 
       // check if we have finished
-      if (_nextPos == 8) // bits numbered 0 to 7
+      if (_nextPos == COL_BITS) // bits numbered 0 to COL_BITS-1
       {
+        commonPrint();
         _fsmState = PAUSE;
         break;
       }
 
-      // blank out the part of the display we don't need
+      // print only the part of the display we need
       FSMPRINT("Keep bit ", _nextPos);
-      maskCol = (1 << _nextPos);
-      for (int16_t i = _startPos; i != _endPos + _posOffset; i += _posOffset)
-      {
-        uint8_t c = DATA_BAR(_MX->getColumn(i) & (bBlank ? ~maskCol : maskCol));
-
-        _MX->setColumn(i, DATA_BAR(c));
-      }
+      maskCol = ((colData_t)1 << _nextPos);
+      commonPrint(bBlank ? ~maskCol : maskCol);
 
       _nextPos++; // for the next time around
       break;
@@ -173,7 +167,7 @@ void MD_PZone::effectVScan(bool bIn, bool bBlank)
     case INITIALISE:
       PRINT_STATE("O SCANV");
       setInitialEffectConditions();
-      _nextPos = 7; // the bit number
+      _nextPos = COL_BITS - 1; // the bit number
       _fsmState = PUT_CHAR;
       // fall through to next state
 
@@ -182,18 +176,11 @@ void MD_PZone::effectVScan(bool bIn, bool bBlank)
     case PUT_CHAR:
       PRINT_STATE("O SCANV");
 
-      commonPrint();
-
-      // blank out the part of the display we don't need
+      // print only the part of the display we need
       FSMPRINT(" Keep bit ", _nextPos);
       if (_nextPos >= 0)
-        maskCol = 1 << _nextPos;
-      for (int16_t i = _startPos; i != _endPos + _posOffset; i += _posOffset)
-      {
-        uint8_t c = DATA_BAR(_MX->getColumn(i) & (bBlank ? ~maskCol : maskCol));
-
-        _MX->setColumn(i, DATA_BAR(c));
-      }
+        maskCol = (colData_t)1 << _nextPos;
+      commonPrint(bBlank ? ~maskCol : maskCol);
 
       // check if we have finished
       if (_nextPos < 0)
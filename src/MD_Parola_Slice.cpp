@@ -44,9 +44,9 @@ void MD_PZone::effectSlice(bool bIn)
         _fsmState = END;
         break;
       }
-      zoneClear();
+      clearFrame();
       _countCols = 0;
-      _nextPos = ZONE_START_COL(_zoneStart);
+      _nextPos = _colStart;
       _endPos = _limitLeft;
 
       FSMPRINT(" - Start ", _nextPos);
@@ -78,7 +78,7 @@ void MD_PZone::effectSlice(bool bIn)
       // if the text is too long for the zone, stop when we are at the last column of the zone
       if (_nextPos == _endPos)
       {
-        _MX->setColumn(_nextPos, DATA_BAR(_cBuf[_countCols]));
+        setFrameColumn(_nextPos, DATA_BAR(_cBuf[_countCols]));
         _fsmState = PAUSE;
         break;
       }
@@ -90,15 +90,15 @@ void MD_PZone::effectSlice(bool bIn)
       else  // something to animate
       {
         // clear the column and animate the next one
-        if (_nextPos != _endPos) _MX->setColumn(_nextPos, EMPTY_BAR);
+        if (_nextPos != _endPos) setFrameColumn(_nextPos, EMPTY_BAR);
         _nextPos++;
-        _MX->setColumn(_nextPos, DATA_BAR(_cBuf[_countCols]));
+        setFrameColumn(_nextPos, DATA_BAR(_cBuf[_countCols]));
       }
 
       // set up for the next time
       if (_nextPos == _endPos)
       {
-        _nextPos = ZONE_START_COL(_zoneStart);
+        _nextPos = _colStart;
         _countCols++;
         _endPos--;
       }
@@ -126,7 +126,7 @@ void MD_PZone::effectSlice(bool bIn)
       FSMPRINT(" - Next ", _endPos);
       FSMPRINT(", anim ", _nextPos);
 
-      while(_MX->getColumn(_nextPos) == EMPTY_BAR && _endPos >= _limitRight)
+      while(getFrameColumn(_nextPos) == EMPTY_BAR && _endPos >= _limitRight)
         _nextPos = _endPos--; // pretend we just animated it!
 
       if (_endPos + 1 < _limitRight)
@@ -134,13 +134,13 @@ void MD_PZone::effectSlice(bool bIn)
       else
       {
         // Move the column over to the left and blank out previous position
-        if (_nextPos < ZONE_END_COL(_zoneEnd))
-          _MX->setColumn(_nextPos + 1, _MX->getColumn(_nextPos));
-        _MX->setColumn(_nextPos, EMPTY_BAR);
+        if (_nextPos < _colEnd)
+          setFrameColumn(_nextPos + 1, getFrameColumn(_nextPos));
+        setFrameColumn(_nextPos, EMPTY_BAR);
         _nextPos++;
 
         // set up for the next time
-        if (_nextPos == ZONE_END_COL(_zoneEnd) + 1)
+        if (_nextPos == _colEnd + 1)
           _nextPos = _endPos--;
       }
       break;
@@ -53,7 +53,7 @@ void MD_PZone::effectSprite(bool bIn, uint8_t id)
         break;
       }
       _posOffset = 0;   // current animation frame for the sprite
-      _nextPos = ZONE_END_COL(_zoneEnd) + 1;
+      _nextPos = _colEnd + 1;
       _fsmState = PUT_CHAR;
       // fall through to next state
 
@@ -69,14 +69,14 @@ void MD_PZone::effectSprite(bool bIn, uint8_t id)
       _nextPos--;
       for (uint8_t i = 0; i < _spriteInWidth; i++)
       {
-        if ((_nextPos + i) <= ZONE_END_COL(_zoneEnd) && (_nextPos + i) >= ZONE_START_COL(_zoneStart))
-          _MX->setColumn(_nextPos + i, DATA_BAR(pgm_read_byte(_spriteInData + (_posOffset * _spriteInWidth) + i)));
+        if ((_nextPos + i) <= _colEnd && (_nextPos + i) >= _colStart)
+          setFrameColumn(_nextPos + i, DATA_BAR(TEXT_COL(pgm_read_byte(_spriteInData + (_posOffset * _spriteInWidth) + i))));
       }
 
       // blank out the part of the display we don't need
       // this is the part to the right of the sprite
       for (int16_t i = _nextPos - 1; i >= _endPos; i--)
-        _MX->setColumn(i, EMPTY_BAR);
+        setFrameColumn(i, EMPTY_BAR);
 
       // advance the animation frame
       _posOffset++;
@@ -84,7 +84,7 @@ void MD_PZone::effectSprite(bool bIn, uint8_t id)
         _posOffset = 0;
 
       // check if we have finished
-      if (_nextPos == ZONE_START_COL(_zoneStart) - _spriteInWidth - 1)
+      if (_nextPos == _colStart - _spriteInWidth - 1)
         _fsmState = PAUSE;
       break;
 
@@ -112,7 +112,7 @@ void MD_PZone::effectSprite(bool bIn, uint8_t id)
         _fsmState = END;
         break;
       }
-      _nextPos = ZONE_START_COL(_zoneStart) - 1;
+      _nextPos = _colStart - 1;
       _posOffset = 0;
       _fsmState = PUT_CHAR;
       // fall through to next state
@@ -127,14 +127,14 @@ void MD_PZone::effectSprite(bool bIn, uint8_t id)
       _nextPos++;
       for (uint8_t i = 0; i < _spriteOutWidth; i++)
       {
-        if ((_nextPos - i) <= ZONE_END_COL(_zoneEnd) && (_nextPos - i) >= ZONE_START_COL(_zoneStart))
-          _MX->setColumn(_nextPos - i, DATA_BAR(pgm_read_byte(_spriteOutData + (_posOffset * _spriteOutWidth) + i)));
+        if ((_nextPos - i) <= _colEnd && (_nextPos - i) >= _colStart)
+          setFrameColumn(_nextPos - i, DATA_BAR(TEXT_COL(pgm_read_byte(_spriteOutData + (_posOffset * _spriteOutWidth) + i))));
       }
 
       // blank out the part of the display we don't need
       // this is the part to the right of the sprite
       for (int16_t i = _nextPos - _spriteOutWidth; i >= _endPos; i--)
-        _MX->setColumn(i, EMPTY_BAR);
+        setFrameColumn(i, EMPTY_BAR);
 
       // advance the animation frame
       _posOffset++;
@@ -142,7 +142,7 @@ void MD_PZone::effectSprite(bool bIn, uint8_t id)
         _posOffset = 0;
 
       // check if we have finished
-      if (_nextPos == ZONE_END_COL(_zoneEnd) + _spriteOutWidth + 1)
+      if (_nextPos == _colEnd + _spriteOutWidth + 1)
         _fsmState = END;
       break;
 
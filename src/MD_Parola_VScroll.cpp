@@ -36,8 +36,7 @@ void MD_PZone::effectVScroll(bool bUp, bool bIn)
     {
     case INITIALISE:
       PRINT_STATE("I VSCROLL");
-      _nextPos = COL_SIZE-1;
-      _MX->control(_zoneStart, _zoneEnd, MD_MAX72XX::WRAPAROUND, MD_MAX72XX::OFF);
+      _nextPos = COL_BITS - 1;
       _fsmState = PUT_CHAR;
       // fall through to next state
 
@@ -47,25 +46,14 @@ void MD_PZone::effectVScroll(bool bUp, bool bIn)
     case PAUSE:
       PRINT_STATE("I VSCROLL");
 
-      zoneClear();
+      clearFrame();
       commonPrint();
 
       // scroll each column of the zone so that the message appears to be animated
       // Note: Directions are reversed here because we start with the message in the
       // middle position thru commonPrint() and to see it animated moving DOWN we
       // need to scroll it UP, and vice versa.
-      for (int16_t j = ZONE_START_COL(_zoneStart); j <= ZONE_END_COL(_zoneEnd); j++)   // for each column
-      {
-        uint8_t c = _MX->getColumn(j);
-
-        for (int8_t i = _nextPos; i > 0; i--)
-        {
-          c = (bUp ? c << 1 : c >> 1);
-          if (_inverted) c |= (bUp ? 0x01 : 0x80);
-        }
-
-        _MX->setColumn(j, c);
-      }
+      shiftFrameBits(!bUp, _nextPos, 0);
 
       // check if we have finished
       if (_nextPos == 0) _fsmState = PAUSE;
@@ -94,18 +82,10 @@ void MD_PZone::effectVScroll(bool bUp, bool bIn)
     case PUT_CHAR:
       PRINT_STATE("O VSCROLL");
 
-      for (int16_t j = ZONE_START_COL(_zoneStart); j <= ZONE_END_COL(_zoneEnd); j++)   // for each column
-      {
-        uint8_t c = _MX->getColumn(j);
-
-        c = (bUp ? c >> 1 : c << 1);
-        if (_inverted) c |= (bUp ? 0x80 : 0x01);
-
-        _MX->setColumn(j, c);
-      }
+      shiftFrameBits(bUp, 1, 0);
 
       // check if we have finished
-      if (_nextPos == COL_SIZE - 1) _fsmState = END;
+      if (_nextPos == COL_BITS - 1) _fsmState = END;
 
       _nextPos++;
       break;
@@ -59,9 +59,9 @@ void MD_PZone::effectWipe(bool bLightBar, bool bIn)
       FSMPRINT(" to ", _endPos);
       FSMPRINT(" step ", _posOffset);
       for (int16_t i = _nextPos; i != _endPos + _posOffset; i += _posOffset)
-        _MX->setColumn(i, EMPTY_BAR);
+        setFrameColumn(i, EMPTY_BAR);
 
-      if (bLightBar && (_nextPos != _endPos + _posOffset)) _MX->setColumn(_nextPos, LIGHT_BAR);
+      if (bLightBar && (_nextPos != _endPos + _posOffset)) setFrameColumn(_nextPos, LIGHT_BAR);
 
       // check if we have finished
       if (_nextPos == _endPos + _posOffset) _fsmState = PAUSE;
@@ -96,9 +96,9 @@ void MD_PZone::effectWipe(bool bLightBar, bool bIn)
       FSMPRINT(" to ", _endPos);
       FSMPRINT(" step ", _posOffset);
       for (int16_t i = _startPos; i != _nextPos + _posOffset; i += _posOffset)
-        _MX->setColumn(i, EMPTY_BAR);
+        setFrameColumn(i, EMPTY_BAR);
 
-      if (bLightBar && (_nextPos != _endPos + _posOffset)) _MX->setColumn(_nextPos, LIGHT_BAR);
+      if (bLightBar && (_nextPos != _endPos + _posOffset)) setFrameColumn(_nextPos, LIGHT_BAR);
 
       // check if we have finished
       if (_nextPos == _endPos + _posOffset) _fsmState = END;
@@ -8,7 +8,6 @@
 
 #define DEBUG_PAROLA      0 ///< Set to 1 to enable General debug output
 #define DEBUG_PAROLA_FSM  0 ///< Set to 1 to enable Finite State Machine debug output
-#define TIME_PROFILING    0 ///< Set to 1 to enable Time Profile debug output
 
 #if  DEBUG_PAROLA
 #define PRINT(s, v) { Serial.print(F(s)); Serial.print(v); }    ///< (GENERAL) Print a string followed by a value (decimal)
@@ -33,8 +32,19 @@
 #endif
 
 // General macros and defines
-#define LIGHT_BAR (_inverted ? 0 : 0xFF)  ///< Turn display column to all LEDs on
-#define EMPTY_BAR (_inverted ? 0xFF : 0)  ///< Turn display column to all LEDs off
+#if ENA_CANVAS
+#define COL_BITS    (_zoneRows * COL_SIZE)        ///< Number of LEDs in a zone column
+#define COL_MASK    _colMask                      ///< All the LEDs in a zone column
+#define TEXT_COL(d) ((colData_t)(d) << _textShift) ///< Place single row font or sprite data in a zone column
+#else
+#define COL_BITS    COL_SIZE  ///< Number of LEDs in a zone column
+#define COL_MASK    0xFF      ///< All the LEDs in a zone column
+#define TEXT_COL(d) (d)       ///< Place single row font or sprite data in a zone column
+#endif
+#define COL_MSB   ((colData_t)1 << (COL_BITS - 1)) ///< The bottom LED in a zone column
+
+#define LIGHT_BAR (_inverted ? 0 : COL_MASK)  ///< Turn display column to all LEDs on
+#define EMPTY_BAR (_inverted ? COL_MASK : 0)  ///< Turn display column to all LEDs off
 #define DATA_BAR(d) (_inverted ? ~d : d)  ///< Turn display column to specified data
 
 // Zone effects masks
@@ -44,6 +54,7 @@
 
 #define ZE_FLIP_UD_MASK 0x01  ///< mask bit 0
 #define ZE_FLIP_LR_MASK 0x02  ///< mask bit 1
+#define ZE_DOUBLE_MASK  0x04  ///< mask bit 2
 
-#define SFX(s) ((_moveIn && _effectIn == (s)) || (!_moveIn && _effectOut == (s))) ///< Effect is selected if it is the effect for the current motion
+#define SFX(s) (activeEffect() == (s)) ///< Effect is selected if it is the effect for the current motion
 